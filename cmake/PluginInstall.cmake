@@ -58,7 +58,7 @@ IF(APPLE)
       INSTALL(TARGETS ${PACKAGE_NAME} RUNTIME LIBRARY DESTINATION ${CMAKE_BINARY_DIR}/OpenCPN.app/Contents/PlugIns)
       
  IF(EXISTS ${PROJECT_SOURCE_DIR}/data)
-    INSTALL(DIRECTORY data DESTINATION ${CMAKE_BINARY_DIR}/OpenCPN.app/Contents/SharedSupport/plugins/${PACKAGE_NAME})
+    INSTALL(DIRECTORY data DESTINATION ${CMAKE_BINARY_DIR}/OpenCPN.app/Contents/SharedSupport/plugins/${PACKAGE_NAME} PATTERN "*.nmea" EXCLUDE)
  ENDIF()
 
 ENDIF(APPLE)
@@ -80,7 +80,7 @@ IF(WIN32)
   ENDIF(CMAKE_CROSSCOMPILING)
 
   IF(EXISTS ${PROJECT_SOURCE_DIR}/data)
-    INSTALL(DIRECTORY data DESTINATION "${INSTALL_DIRECTORY}")
+    INSTALL(DIRECTORY data DESTINATION "${INSTALL_DIRECTORY}" PATTERN "*.nmea" EXCLUDE)
   ENDIF(EXISTS ${PROJECT_SOURCE_DIR}/data)
 ENDIF(WIN32)
 
@@ -92,7 +92,7 @@ IF(UNIX AND NOT APPLE)
   INSTALL(TARGETS ${PACKAGE_NAME} RUNTIME LIBRARY DESTINATION ${PREFIX_PLUGINS})
 
   IF(EXISTS ${PROJECT_SOURCE_DIR}/data)
-    INSTALL(DIRECTORY data DESTINATION ${PREFIX_PARENTDATA}/plugins/${PACKAGE_NAME})
+    INSTALL(DIRECTORY data DESTINATION ${PREFIX_PARENTDATA}/plugins/${PACKAGE_NAME} PATTERN "*.nmea" EXCLUDE)
   ENDIF()
 ENDIF(UNIX AND NOT APPLE)
 
@@ -14,17 +14,27 @@ SET(SRC_NMEA0183
     src/nmea0183/talkerid.cpp
     src/nmea0183/rmc.cpp
     src/nmea0183/hexvalue.cpp
+    src/nmea0183/decode.cpp
+    src/nmea0183/checksum.cpp
+    src/nmea0183/framer.cpp
+    src/nmea0183/tagblock.cpp
+    src/nmea0183/stats.cpp
+    src/nmea0183/bulkdecoder.cpp
+    src/nmea0183/encoder.cpp
     src/nmea0183/lat.cpp
     src/nmea0183/expid.cpp
     src/nmea0183/wpl.cpp
     src/nmea0183/rte.cpp
+    src/nmea0183/route.cpp
     src/nmea0183/hdt.cpp
     src/nmea0183/hdg.cpp
     src/nmea0183/hdm.cpp
+    src/nmea0183/rot.cpp
     src/nmea0183/gll.cpp
     src/nmea0183/vtg.cpp
     src/nmea0183/gga.cpp
     src/nmea0183/gsv.cpp
+    src/nmea0183/sattable.cpp
     src/nmea0183/dbt.cpp
     src/nmea0183/dpt.cpp
     src/nmea0183/mtw.cpp
@@ -43,4 +53,8 @@ SET(SRC_NMEA0183
 INCLUDE_DIRECTORIES(src/nmea0183)
 
 ADD_LIBRARY(LIB_PLUGINNMEA0183 STATIC ${SRC_NMEA0183})
+
+# BULK_DECODER runs on std::thread
+FIND_PACKAGE(Threads)
+TARGET_LINK_LIBRARIES( LIB_PLUGINNMEA0183 ${CMAKE_THREAD_LIBS_INIT} )
 TARGET_LINK_LIBRARIES( ${PACKAGE_NAME} LIB_PLUGINNMEA0183 )
@@ -0,0 +1,49 @@
+##---------------------------------------------------------------------------
+## Author:      Sean D'Epagnier
+## Copyright:   2019
+## License:     GPLv3+
+##---------------------------------------------------------------------------
+
+# Programs that exercise LIB_PLUGINNMEA0183 outside OpenCPN, not installed.
+#   nmea_bench [corpus] [seconds]  ns and allocations per sentence type
+#   nmea_fuzz                      libFuzzer target over NMEA0183::Parse
+#   rotation_replay log.nmea       the plugin driven by a recorded log on a
+#                                  virtual clock, see tools/rotation_replay.cpp
+#   angle_bench [samples/update]   AngleFilter against the old angle filter
+# recorded corpora live in data/*.nmea
+
+OPTION(BUILD_NMEA_TOOLS "Build the nmea_bench, nmea_fuzz, rotation_replay and angle_bench programs" OFF)
+
+IF(BUILD_NMEA_TOOLS)
+  ADD_EXECUTABLE(nmea_bench tools/nmea_bench.cpp)
+  SET_TARGET_PROPERTIES(nmea_bench PROPERTIES
+    COMPILE_DEFINITIONS NMEA_BENCH_CORPUS="${PROJECT_SOURCE_DIR}/data/sailing.nmea")
+  TARGET_LINK_LIBRARIES(nmea_bench LIB_PLUGINNMEA0183 ${wxWidgets_LIBRARIES})
+
+  # the parser is compiled again so the fuzzer's instrumentation covers it
+  ADD_EXECUTABLE(nmea_fuzz tools/nmea_fuzz.cpp ${SRC_NMEA0183})
+  IF(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+    SET_TARGET_PROPERTIES(nmea_fuzz PROPERTIES
+      COMPILE_FLAGS "-fsanitize=fuzzer,address,undefined"
+      LINK_FLAGS "-fsanitize=fuzzer,address,undefined")
+  ELSE(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+    # without libFuzzer it replays the input files it is given
+    SET_TARGET_PROPERTIES(nmea_fuzz PROPERTIES COMPILE_DEFINITIONS NMEA_FUZZ_MAIN)
+  ENDIF(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+  TARGET_LINK_LIBRARIES(nmea_fuzz ${wxWidgets_LIBRARIES} ${CMAKE_THREAD_LIBS_INIT})
+
+  # the plugin sources with tools/ocpn_host.cpp standing in for OpenCPN
+  ADD_EXECUTABLE(rotation_replay
+    tools/rotation_replay.cpp
+    tools/ocpn_host.cpp
+    src/rotationctrl_pi.cpp
+    src/NMEAThread.cpp
+    src/PreferencesDialog.cpp
+    src/RotationCtrlUI.cpp
+    src/wxJSON/jsonreader.cpp
+    src/wxJSON/jsonval.cpp
+    src/wxJSON/jsonwriter.cpp)
+  TARGET_LINK_LIBRARIES(rotation_replay LIB_PLUGINNMEA0183 ${wxWidgets_LIBRARIES})
+
+  ADD_EXECUTABLE(angle_bench tools/angle_bench.cpp)
+ENDIF(BUILD_NMEA_TOOLS)
@@ -0,0 +1,82 @@
+/******************************************************************************
+ *
+ * Project:  OpenCPN
+ * Purpose:  rotationctrl angle filter
+ * Author:   Sean D'Epagnier
+ *
+ ***************************************************************************
+ *   Copyright (C) 2018 by Sean D'Epagnier                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+#ifndef _ANGLEFILTER_H_
+#define _ANGLEFILTER_H_
+
+#include <math.h>
+
+// Low pass filter of a direction in degrees, kept as the filtered unit
+// vector (north is +y, east +x) rather than as an angle.  A sample costs
+// one sin and one cos, the state never has to be turned back into an angle
+// to take the next one and there is nothing to wrap; Angle() does the only
+// atan2, when a rotation is actually wanted.
+class AngleFilter
+{
+public:
+    AngleFilter() { Reset(); }
+
+    void Reset() { m_x = m_y = NAN; }
+    bool IsValid() const { return !isnan(m_x); }
+
+    // mix in gain (0 to 1) of a sample, the first one is taken as is
+    void Update(double degrees, double gain) {
+        double radians = degrees * (M_PI / 180);
+        double x = sin(radians), y = cos(radians);
+        if(!IsValid()) {
+            m_x = x, m_y = y;
+            return;
+        }
+        m_x += gain * (x - m_x);
+        m_y += gain * (y - m_y);
+    }
+
+    // turn the filtered direction clockwise, to carry it through a turn
+    void Rotate(double degrees) {
+        if(!IsValid() || degrees == 0)
+            return;
+        double radians = degrees * (M_PI / 180);
+        double s = sin(radians), c = cos(radians);
+        double x = m_x * c + m_y * s;
+        m_y = m_y * c - m_x * s;
+        m_x = x;
+    }
+
+    // 0 to 360, NAN before the first sample
+    double Angle() const {
+        if(!IsValid())
+            return NAN;
+        double degrees = atan2(m_x, m_y) * (180 / M_PI);
+        if(degrees < 0)
+            degrees += 360;
+        return degrees < 360 ? degrees : 0;
+    }
+
+private:
+    double m_x, m_y;
+};
+
+#endif
@@ -0,0 +1,127 @@
+/******************************************************************************
+ *
+ * Project:  OpenCPN
+ * Purpose:  rotationctrl heading estimator
+ * Author:   Sean D'Epagnier
+ *
+ ***************************************************************************
+ *   Copyright (C) 2018 by Sean D'Epagnier                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+#ifndef _HEADINGKALMAN_H_
+#define _HEADINGKALMAN_H_
+
+#include <math.h>
+
+// Kalman filter on heading and rate of turn, for heading or course up.
+// Degrees, degrees per second and seconds on any clock.  Headings (HDT,
+// HDM, COG) and rates (ROT) are both measurements of the one state, and a
+// heading innovation is taken the short way round, so nothing wraps.
+// Holding a course it averages like a low pass, in a turn the rate carries
+// the estimate along with the boat instead of trailing it.
+class HeadingKalman
+{
+public:
+    HeadingKalman() : ProcessNoise(0.01) { Reset(); }
+
+    void Reset() { m_time = NAN; }
+    bool IsValid() const { return !isnan(m_time); }
+
+    // how freely the rate of turn may change, in (degrees/s^2)^2 per second
+    double ProcessNoise;
+
+    void Heading(double time, double degrees, double variance) {
+        if(isnan(degrees))
+            return;
+
+        if(!IsValid()) {
+            m_time = time;
+            m_heading = degrees;
+            m_rate = 0;
+            m_p00 = variance;
+            m_p01 = 0;
+            m_p11 = 100; // turning at up to 10 degrees/s, who knows
+            return;
+        }
+
+        Predict(time);
+        double innovation = remainder(degrees - m_heading, 360);
+        double s = m_p00 + variance;
+        double k0 = m_p00 / s, k1 = m_p01 / s;
+        m_heading = Resolve(m_heading + k0 * innovation);
+        m_rate += k1 * innovation;
+        m_p11 -= k1 * m_p01;
+        m_p01 -= k0 * m_p01;
+        m_p00 -= k0 * m_p00;
+    }
+
+    // rate of turn, positive to starboard
+    void RateOfTurn(double time, double rate, double variance) {
+        if(isnan(rate) || !IsValid())
+            return;
+
+        Predict(time);
+        double innovation = rate - m_rate;
+        double s = m_p11 + variance;
+        double k0 = m_p01 / s, k1 = m_p11 / s;
+        m_heading = Resolve(m_heading + k0 * innovation);
+        m_rate += k1 * innovation;
+        m_p00 -= k0 * m_p01;
+        m_p01 -= k0 * m_p11;
+        m_p11 -= k1 * m_p11;
+    }
+
+    // 0 to 360, carried forward to time by the rate; NAN before a heading
+    double Angle(double time) const {
+        if(!IsValid())
+            return NAN;
+        return Resolve(m_heading + m_rate * Extrapolation(time - m_time));
+    }
+
+    double Rate() const { return IsValid() ? m_rate : NAN; }
+
+private:
+    // measurements stopped, don't spin the chart on a guess
+    static double Extrapolation(double dt) { return dt < 0 ? 0 : dt > 2 ? 2 : dt; }
+
+    static double Resolve(double degrees) {
+        degrees = fmod(degrees, 360);
+        return degrees < 0 ? degrees + 360 : degrees;
+    }
+
+    // constant rate of turn between measurements, a sample older than
+    // the state is taken as of the state's time
+    void Predict(double time) {
+        double dt = time - m_time;
+        if(dt <= 0)
+            return;
+
+        m_heading = Resolve(m_heading + m_rate * Extrapolation(dt));
+        double q = ProcessNoise;
+        m_p00 += dt * (2 * m_p01 + dt * m_p11) + q * dt * dt * dt / 3;
+        m_p01 += dt * m_p11 + q * dt * dt / 2;
+        m_p11 += q * dt;
+        m_time = time;
+    }
+
+    double m_time, m_heading, m_rate;
+    double m_p00, m_p01, m_p11; // covariance of heading and rate
+};
+
+#endif
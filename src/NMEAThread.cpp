@@ -0,0 +1,124 @@
+/******************************************************************************
+ *
+ * Project:  OpenCPN
+ * Purpose:  rotationctrl Plugin
+ * Author:   Sean D'Epagnier
+ *
+ ***************************************************************************
+ *   Copyright (C) 2018 by Sean D'Epagnier                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+#include "rotationctrl_pi.h"
+#include "NMEAThread.h"
+
+bool SentenceQueue::Push(const wxString &sentence, int tool)
+{
+    // too long for the parser, refused whole rather than cut short
+    int length = sentence.Len(), line = 0;
+    while(line < length && sentence[line] != '\r' && sentence[line] != '\n')
+        line++;
+    if(line > NMEA0183_MAX_SENTENCE_LENGTH) {
+        m_oversized++;
+        return false;
+    }
+
+    unsigned int head = m_head.load(std::memory_order_relaxed);
+    if(head - m_tail.load(std::memory_order_acquire) == SENTENCE_QUEUE_SIZE) {
+        m_dropped++; // consumer fell behind, newer data will follow
+        return false;
+    }
+
+    // narrow to ascii in place, nmea is 7 bit so anything else fails the checksum
+    Slot &slot = m_slots[head & (SENTENCE_QUEUE_SIZE - 1)];
+    length = wxMin(length, NMEA0183_MAX_SENTENCE_LENGTH); // anything cut is line ending
+    for(int i=0; i<length; i++) {
+        wxChar c = sentence[i];
+        slot.data[i] = (c >= 0 && c < 0x80) ? (char)c : 0x7f;
+    }
+    slot.data[length] = 0;
+    slot.length = length;
+    slot.tool = tool;
+
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+const char *SentenceQueue::Front(int &length, int &tool)
+{
+    unsigned int tail = m_tail.load(std::memory_order_relaxed);
+    if(tail == m_head.load(std::memory_order_acquire))
+        return NULL;
+
+    Slot &slot = m_slots[tail & (SENTENCE_QUEUE_SIZE - 1)];
+    length = slot.length;
+    tool = slot.tool;
+    return slot.data;
+}
+
+void SentenceQueue::Pop()
+{
+    // the slot may be reused as soon as this is visible to the producer
+    m_tail.store(m_tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+NMEAThread::NMEAThread(rotationctrl_pi &pi, NMEA0183_CHECKSUM_MODE checksum_mode,
+                       int timing_interval)
+    : wxThread(wxTHREAD_JOINABLE), m_pi(pi)
+{
+    m_NMEA0183.SetChecksumMode(checksum_mode);
+    m_NMEA0183.Statistics.TimingInterval = timing_interval;
+}
+
+void NMEAThread::Enqueue(const wxString &sentence, int tool)
+{
+    if(m_queue.Push(sentence, tool))
+        m_wake.Post();
+}
+
+wxThread::ExitCode NMEAThread::Entry()
+{
+    while(!TestDestroy()) {
+        // time out now and then so Delete() is noticed
+        if(m_wake.WaitTimeout(250) != wxSEMA_NO_ERROR)
+            continue;
+
+        wxCriticalSectionLocker lock(m_statistics_lock);
+        int length, tool;
+        const char *data;
+        bool updated = false;
+        while((data = m_queue.Front(length, tool))) {
+            // parsed in place, the slot is only released afterwards
+            m_NMEA0183.Assign(data, length);
+            updated |= m_pi.ProcessNMEA(m_NMEA0183, tool);
+            m_queue.Pop();
+        }
+
+        // the update timer belongs to the gui thread, one request per batch
+        if(updated)
+            m_pi.CallAfter(&rotationctrl_pi::InputUpdated);
+    }
+
+    return 0;
+}
+
+void NMEAThread::GetStatistics(PARSE_STATISTICS &statistics)
+{
+    wxCriticalSectionLocker lock(m_statistics_lock);
+    statistics = m_NMEA0183.Statistics;
+}
@@ -0,0 +1,88 @@
+/******************************************************************************
+ *
+ * Project:  OpenCPN
+ * Purpose:  rotationctrl Plugin
+ * Author:   Sean D'Epagnier
+ *
+ ***************************************************************************
+ *   Copyright (C) 2018 by Sean D'Epagnier                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+#ifndef _NMEATHREAD_H_
+#define _NMEATHREAD_H_
+
+#include <atomic>
+
+#include <wx/thread.h>
+
+#include <nmea0183.h>
+
+class rotationctrl_pi;
+
+// Fixed size single producer / single consumer queue of raw sentences.
+// The GUI thread pushes and the NMEA thread pops, neither ever blocks.
+#define SENTENCE_QUEUE_SIZE 64 // power of two
+
+class SentenceQueue
+{
+public:
+    SentenceQueue() : m_head(0), m_tail(0), m_dropped(0), m_oversized(0) {}
+
+    bool Push(const wxString &sentence, int tool);
+    const char *Front(int &length, int &tool);
+    void Pop();
+
+    unsigned long Dropped() { return m_dropped; }
+    unsigned long Oversized() { return m_oversized; }
+
+private:
+    struct Slot {
+        int length, tool;
+        char data[NMEA0183_MAX_SENTENCE_LENGTH + 1];
+    };
+
+    Slot m_slots[SENTENCE_QUEUE_SIZE];
+    std::atomic<unsigned int> m_head, m_tail;
+    unsigned long m_dropped, m_oversized; // only touched by the producer
+};
+
+// Parses and filters queued sentences off the GUI thread,
+// rotationctrl_pi::OnTimer only picks up the filtered result
+class NMEAThread : public wxThread
+{
+public:
+    NMEAThread(rotationctrl_pi &pi, NMEA0183_CHECKSUM_MODE checksum_mode, int timing_interval);
+
+    void Enqueue(const wxString &sentence, int tool);
+    unsigned long Dropped() { return m_queue.Dropped(); }
+    unsigned long Oversized() { return m_queue.Oversized(); }
+    void GetStatistics(PARSE_STATISTICS &statistics);
+
+protected:
+    ExitCode Entry();
+
+private:
+    rotationctrl_pi &m_pi;
+    NMEA0183 m_NMEA0183; // only used by this thread
+    wxCriticalSection m_statistics_lock; // held while a batch is parsed
+    SentenceQueue m_queue;
+    wxSemaphore m_wake;
+};
+
+#endif
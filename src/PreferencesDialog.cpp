@@ -42,7 +42,7 @@ PreferencesDialog::PreferencesDialog( wxWindow* parent)
     m_cbRouteUp->SetValue((bool)pConf->Read( _T ( "RouteUp" ), 0L));
     m_cbWindUp->SetValue((bool)pConf->Read( _T ( "WindUp" ), 0L));
 
-    m_sUpdateRate->SetValue( pConf->ReadDouble( _T ( "UpdateRate" ), 3.0));
+    m_sUpdateRate->SetValue( pConf->ReadDouble( _T ( "UpdateRate" ), 5.0));
     m_sFilterSeconds->SetValue( pConf->Read( _T ( "FilterSeconds" ), 5L));
     m_sMaxSlewRate->SetValue( pConf->ReadDouble( _T ( "MaxSlewRate" ), 5.0));
     m_sRotationOffset->SetValue( pConf->Read( _T ( "RotationOffset" ), 0L));
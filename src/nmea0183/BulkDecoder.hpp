@@ -0,0 +1,146 @@
+/***************************************************************************
+ *
+ * Project:  OpenCPN
+ * Purpose:  NMEA0183 Support Classes
+ * Author:   Sean D'Epagnier
+ *
+ ***************************************************************************
+ *   Copyright (C) 2018 by Sean D'Epagnier                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.             *
+ ***************************************************************************
+ */
+
+
+
+#if ! defined( BULK_DECODER_CLASS_HEADER )
+#define BULK_DECODER_CLASS_HEADER
+
+/*
+** Decodes a whole recorded log at once for analysis afterwards.  The file
+** is memory mapped and cut at line boundaries into one piece per thread,
+** every thread parses its piece in place with its own NMEA0183 and the
+** pieces are joined in time order:
+**
+**    BULK_DECODER decoder;
+**    BULK_COLUMNS columns;
+**
+**    decoder.Select( SID_HDT );
+**    decoder.Select( SID_MWV );
+**
+**    if ( decoder.Decode( "voyage.nmea", columns ) )
+**    {
+**       for( size_t row = 0; row < columns.Count; row++ )
+**          ... columns.Time[ row ], columns.HeadingTrue[ row ] ...
+**    }
+**
+** Each selected sentence becomes a row.  A row's time is its tag block
+** time, otherwise the last RMC or ZDA time before it in the log.
+*/
+
+/*
+** One row per sentence, one array per quantity.  A column a sentence does
+** not carry is NAN in its rows.  Speeds are in knots, angles in degrees as
+** sent.  Measurements are kept as float, which is plenty for what a
+** sensor sends and halves the memory a long log takes.
+*/
+
+class BULK_COLUMNS
+{
+   private:
+
+      size_t capacity;
+
+      bool reserve( size_t rows );
+
+      /*
+      ** Owns its columns, use Swap() instead of copying
+      */
+
+      BULK_COLUMNS( const BULK_COLUMNS& );
+      const BULK_COLUMNS& operator = ( const BULK_COLUMNS& );
+
+   public:
+
+      BULK_COLUMNS();
+      virtual ~BULK_COLUMNS();
+
+      /*
+      ** Data
+      */
+
+      size_t Count;
+
+      double        *Time;              // Seconds since 1970, NAN until the log says
+      unsigned char *Sentence;          // SENTENCE_ID of the row
+      float         *HeadingTrue;       // HDT
+      float         *CourseTrue;        // RMC, VTG
+      float         *SpeedKnots;        // RMC, VTG over ground
+      float         *ApparentWindAngle; // MWV relative
+      float         *ApparentWindSpeed;
+      float         *TrueWindAngle;     // MWV true
+      float         *TrueWindSpeed;
+      double        *Latitude;          // RMC, south is negative
+      double        *Longitude;         // RMC, west is negative
+
+      /*
+      ** Methods
+      */
+
+      void Clear( void );
+      int  AddRow( double time, SENTENCE_ID sentence_id ); // Index of the new row, -1 out of memory
+      bool Append( const BULK_COLUMNS& source );
+      bool Merge( const BULK_COLUMNS& source ); // Both already in time order
+      bool SortByTime( void );
+      bool IsSortedByTime( void ) const;
+      void Swap( BULK_COLUMNS& other );
+};
+
+class BULK_DECODER
+{
+   private:
+
+      bool selected[ SID_Count ];
+
+   public:
+
+      BULK_DECODER();
+      virtual ~BULK_DECODER();
+
+      /*
+      ** Data
+      */
+
+      int Threads; // 0 for one per processor
+
+      unsigned long long Lines;
+      PARSE_STATISTICS Statistics; // Of every thread together
+
+      wxString ErrorMessage; // Filled when Decode returns false
+
+      /*
+      ** Methods
+      */
+
+      bool Select( SENTENCE_ID sentence_id ); // HDT, MWV, RMC and VTG have columns
+      void Deselect( void );
+      bool IsSelected( SENTENCE_ID sentence_id ) const;
+
+      bool Decode( const char *path, BULK_COLUMNS& columns );
+      bool Decode( const char *data, size_t length, BULK_COLUMNS& columns );
+};
+
+#endif // BULK_DECODER_CLASS_HEADER
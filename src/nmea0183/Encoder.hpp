@@ -0,0 +1,92 @@
+/***************************************************************************
+ *
+ * Project:  OpenCPN
+ * Purpose:  NMEA0183 Support Classes
+ * Author:   Sean D'Epagnier
+ *
+ ***************************************************************************
+ *   Copyright (C) 2018 by Sean D'Epagnier                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.             *
+ ***************************************************************************
+ */
+
+
+#if ! defined( ENCODER_CLASS_HEADER )
+#define ENCODER_CLASS_HEADER
+
+/*
+** Builds a sentence straight into a caller's char buffer, the bytes
+** SENTENCE::Write() would produce but without a wxString, a Printf() or
+** an allocation anywhere along the way.  The checksum is kept up to date
+** as each character goes in.
+**
+**    char buffer[ NMEA0183_MAX_SENTENCE_LENGTH + 1 ];
+**
+**    nmea.Hdt.DegreesTrue = heading;
+**    int length = nmea.Hdt.Encode( buffer, sizeof( buffer ), TALKER_CODE( 'R', 'C' ) );
+**
+** gives "$RCHDT,123.400,T*hh\r\n", NUL terminated.  Finish() (and so
+** Encode()) returns 0 when the sentence did not fit.
+*/
+
+class ENCODER
+{
+   private:
+
+      char *buffer;
+      int buffer_size;
+      int length;
+      unsigned char checksum;
+      bool overflow;
+
+      void put( char character );
+      void put_unsigned( unsigned long long value, int minimum_digits );
+
+   public:
+
+      ENCODER( char *buffer, int buffer_size );
+      virtual ~ENCODER();
+
+      /*
+      ** Methods
+      */
+
+      void Begin( unsigned short talker_code, const wxString& mnemonic );
+      void Append( const wxString& characters, int first, int last );
+      void Unit( char unit );
+      int Finish( void );
+      int GetLength( void ) const;
+      bool IsOverflow( void ) const;
+
+      /*
+      ** Operators, each one adds a field
+      */
+
+      ENCODER& operator += ( const wxString& value );
+      ENCODER& operator += ( const char *value );
+      ENCODER& operator += ( double value );
+      ENCODER& operator += ( int value );
+      ENCODER& operator += ( NORTHSOUTH northing );
+      ENCODER& operator += ( EASTWEST easting );
+      ENCODER& operator += ( LEFTRIGHT left_or_right );
+      ENCODER& operator += ( NMEA0183_BOOLEAN boolean );
+      ENCODER& operator += ( const LATITUDE& latitude );
+      ENCODER& operator += ( const LONGITUDE& longitude );
+      ENCODER& operator += ( const LATLONG& position );
+};
+
+#endif // ENCODER_CLASS_HEADER
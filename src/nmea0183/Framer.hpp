@@ -0,0 +1,104 @@
+/***************************************************************************
+ *
+ * Project:  OpenCPN
+ * Purpose:  NMEA0183 Support Classes
+ * Author:   Sean D'Epagnier
+ *
+ ***************************************************************************
+ *   Copyright (C) 2018 by Sean D'Epagnier                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.             *
+ ***************************************************************************
+ */
+
+
+#if ! defined( FRAMER_CLASS_HEADER )
+#define FRAMER_CLASS_HEADER
+
+/*
+** Cuts an arbitrarily chunked byte stream (serial port, socket, log file)
+** into sentences.  A sentence starts at '$' or '!' and ends at CR or LF,
+** a new start character in the middle of a sentence throws away the
+** partial one so the stream resynchronizes on the next good sentence.
+** An NMEA 4 tag block ("\s:src*hh\") stays in front of its sentence.
+**
+** Sentences lying wholly inside a chunk are handed out as views of the
+** caller's bytes.  Only a sentence split across two chunks is put
+** together in the framer's own buffer.
+**
+**    framer.Write( data, length );
+**
+**    while( framer.Next( nmea ) )
+**    {
+**       nmea.Parse();
+**    }
+**
+** The chunk must stay put until Next() returns false, and each sentence
+** must be used before Next() is called again.
+*/
+
+class NMEA0183;
+
+class FRAMER
+{
+   private:
+
+      const char *chunk;
+      int chunk_length;
+      int position;
+
+      bool in_sentence;
+
+      typedef enum
+      {
+         TagBlockNone = 0,
+         TagBlockOpen,  // Between the two backslashes
+         TagBlockClosed // The closing backslash was the last character
+      } TAG_BLOCK_STATE;
+
+      TAG_BLOCK_STATE tag_block_state;
+      int sentence_start; // Index into chunk, -1 when the sentence began in carry
+
+      char carry[ NMEA0183_MAX_SENTENCE_LENGTH + 1 ];
+      int carry_length;
+
+      int current_length( void ) const;
+      void overrun( void );
+
+   public:
+
+      FRAMER();
+      virtual ~FRAMER();
+
+      /*
+      ** Data
+      */
+
+      unsigned long Sentences;      // Sentences handed out by Next()
+      unsigned long DiscardedBytes; // Bytes outside of any sentence, or in one that was cut short
+      unsigned long Overruns;       // Sentences longer than NMEA0183_MAX_SENTENCE_LENGTH
+
+      /*
+      ** Methods
+      */
+
+      void Reset( void );
+      void Write( const char *data, int length );
+      bool Next( const char *& sentence, int& length );
+      bool Next( NMEA0183& nmea );
+};
+
+#endif // FRAMER_CLASS_HEADER
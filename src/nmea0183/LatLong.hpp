@@ -55,10 +55,12 @@ class LATITUDE
       ** Data
       */
 
-      double Latitude;
+      double Latitude; // As sent, (d)ddmm.mmmm
 
       NORTHSOUTH Northing;
 
+      int DegreesE7; // Decimal degrees * 10^7, south is negative
+
       /*
       ** Methods
       */
@@ -88,10 +90,12 @@ class LONGITUDE
       ** Data
       */
 
-      double Longitude;
+      double Longitude; // As sent, (d)ddmm.mmmm
 
       EASTWEST Easting;
 
+      int DegreesE7; // Decimal degrees * 10^7, west is negative
+
       /*
       ** Methods
       */
@@ -71,6 +71,7 @@ class RMB : public RESPONSE
       virtual void Empty( void );
       virtual bool Parse( const SENTENCE& sentence );
       virtual bool Write( SENTENCE& sentence );
+      virtual int Encode( char *buffer, int buffer_size, unsigned short talker_code );
 
       /*
       ** Operators
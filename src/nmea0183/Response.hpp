@@ -42,6 +42,7 @@
 */
 
 class NMEA0183;
+class ENCODER;
 
 class RESPONSE 
 {
@@ -61,6 +62,7 @@ class RESPONSE
 
       wxString ErrorMessage;
       wxString Mnemonic;
+      SENTENCE_ID SentenceID;
       wxString Talker;
 
       /*
@@ -69,10 +71,12 @@ class RESPONSE
 
       virtual void Empty( void ) = 0;
       virtual bool Parse( const SENTENCE& sentence ) = 0;
-      virtual const wxString& PlainEnglish( void );
+      virtual wxString PlainEnglish( void );
       virtual void SetErrorMessage( const wxString& );
       virtual void SetContainer( NMEA0183 *container );
       virtual bool Write( SENTENCE& sentence );
+      void Write( ENCODER& encoder, unsigned short talker_code );
+      virtual int Encode( char *buffer, int buffer_size, unsigned short talker_code );
 };
 
 
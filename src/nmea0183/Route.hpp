@@ -0,0 +1,93 @@
+/***************************************************************************
+ *
+ * Project:  OpenCPN
+ * Purpose:  NMEA0183 Support Classes
+ * Author:   Sean D'Epagnier
+ *
+ ***************************************************************************
+ *   Copyright (C) 2018 by Sean D'Epagnier                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.             *
+ ***************************************************************************
+ */
+
+
+#if ! defined( ROUTE_CLASS_HEADER )
+#define ROUTE_CLASS_HEADER
+
+/*
+** Waypoint identifiers of a route, packed NUL terminated one after the
+** other in a single arena.  Clear() keeps the arena, so a route that is
+** sent over and over only allocates until the arena is big enough.
+*/
+
+#define ROUTE_NAME_LENGTH 80
+
+class ROUTE
+{
+   private:
+
+      char *arena;
+      int arena_size;
+      int arena_used;
+
+      int *offsets; // Start of each identifier in arena
+      int offsets_size;
+      int number_of_waypoints;
+
+      char name[ ROUTE_NAME_LENGTH + 1 ];
+
+      bool reserve( int characters );
+
+      /*
+      ** Owns its arena, use Swap() instead of copying
+      */
+
+      ROUTE( const ROUTE& );
+      const ROUTE& operator = ( const ROUTE& );
+
+   public:
+
+      ROUTE();
+      virtual ~ROUTE();
+
+      /*
+      ** Data
+      */
+
+      ROUTE_TYPE TypeOfRoute;
+
+      /*
+      ** Methods
+      */
+
+      void Clear( void );
+      bool Add( const char *identifier, int length );
+      bool Add( const wxString& identifier );
+      int GetCount( void ) const;
+      const char *GetName( void ) const;
+      bool IsNamed( const char *route_name, int length ) const;
+      void SetName( const char *route_name, int length );
+      void Swap( ROUTE& other );
+
+      /*
+      ** Operators
+      */
+
+      const char *operator [] ( int index ) const;
+};
+
+#endif // ROUTE_CLASS_HEADER
@@ -0,0 +1,104 @@
+/***************************************************************************
+ *
+ * Project:  OpenCPN
+ * Purpose:  NMEA0183 Support Classes
+ * Author:   Sean D'Epagnier
+ *
+ ***************************************************************************
+ *   Copyright (C) 2018 by Sean D'Epagnier                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.             *
+ ***************************************************************************
+ */
+
+
+#if ! defined( SATELLITE_TABLE_CLASS_HEADER )
+#define SATELLITE_TABLE_CLASS_HEADER
+
+/*
+** Puts the GSV messages of a cycle back together.  Every talker (GP, GL,
+** GA, GB...) sends its own cycle of up to 9 messages, a cycle only shows
+** up in the table once its last message arrives in order, replacing what
+** that talker reported before.  A cycle with a missing or out of order
+** message is thrown away.
+**
+**    if ( nmea.LastSentenceParsed == SID_GSV && nmea.Satellites.Cycles != last_cycles )
+**    {
+**       usable = nmea.Satellites.SatellitesAbove( 30 );
+**    }
+**
+** Between two cycles the table stays exactly as the last one left it, and
+** nothing is allocated after construction.
+*/
+
+#define SATELLITE_TABLE_SIZE      64 // Satellites kept from all talkers together
+#define SATELLITES_PER_GSV_CYCLE  36 // 9 messages of 4
+
+typedef struct
+{
+   CONSTELLATION Constellation;
+   SAT_INFO      Info;
+} SATELLITE;
+
+class SATELLITE_TABLE
+{
+   private:
+
+      /*
+      ** One source per constellation talker, GN (mixed) uses ConstellationUnknown
+      */
+
+      typedef struct
+      {
+         int       NumberOfMessages;  // Of the cycle being collected
+         int       NextMessage;       // 0 when waiting for message 1
+         int       NumberCollected;
+         SATELLITE Collected[ SATELLITES_PER_GSV_CYCLE ];
+         int       NumberPublished;
+         SATELLITE Published[ SATELLITES_PER_GSV_CYCLE ];
+      } SOURCE;
+
+      SOURCE sources[ ConstellationCount ];
+
+      void publish( SOURCE& source );
+
+   public:
+
+      SATELLITE_TABLE();
+      virtual ~SATELLITE_TABLE();
+
+      /*
+      ** Data, sorted by constellation then PRN
+      */
+
+      int           NumberOfSatellites;
+      SATELLITE     Satellite[ SATELLITE_TABLE_SIZE ];
+
+      unsigned long Cycles;       // Complete cycles taken into the table
+      unsigned long BrokenCycles; // Cycles thrown away for a missing message
+
+      /*
+      ** Methods
+      */
+
+      void Reset( void );
+      bool Add( const GSV& gsv, unsigned short talker_code );
+      const SATELLITE *Find( CONSTELLATION constellation, int prn ) const;
+      int SatellitesAbove( int signal_to_noise_ratio ) const;
+      double MeanSignalToNoiseRatio( void ) const;
+};
+
+#endif // SATELLITE_TABLE_CLASS_HEADER
@@ -0,0 +1,227 @@
+/***************************************************************************
+ *
+ * Project:  OpenCPN
+ * Purpose:  NMEA0183 Support Classes
+ * Author:   Sean D'Epagnier
+ *
+ ***************************************************************************
+ *   Copyright (C) 2018 by Sean D'Epagnier                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.             *
+ ***************************************************************************
+ */
+
+
+#if ! defined( SCHEMA_CLASS_HEADER )
+#define SCHEMA_CLASS_HEADER
+
+/*
+** Compile time field layouts for response classes.  A sentence is
+** described once as the list of its fields in order,
+**
+**    typedef NMEA0183_SCHEMA<
+**       NMEA0183_FIELD( HDT, DegreesTrue, 1 ),
+**       NMEA0183_UNIT( 2, 'T' ) > HDT_SCHEMA;
+**
+** and HDT_SCHEMA::Parse(), Write(), Empty() and Copy() are expanded
+** into straight line code for that sentence.  Write() takes either a
+** SENTENCE or an ENCODER.  Fields must be listed
+** without gaps, which is checked when compiling, so whatever Write()
+** puts out lines up with what Parse() reads.
+*/
+
+/*
+** How each member type is read, written and emptied
+*/
+
+inline void parse_field( const SENTENCE& sentence, int field_number, double& value )
+{
+   value = sentence.Double( field_number );
+}
+
+inline void parse_field( const SENTENCE& sentence, int field_number, int& value )
+{
+   value = sentence.Integer( field_number );
+}
+
+inline void parse_field( const SENTENCE& sentence, int field_number, wxString& value )
+{
+   sentence.Field( field_number, value );
+}
+
+inline void parse_field( const SENTENCE& sentence, int field_number, NMEA0183_BOOLEAN& value )
+{
+   value = sentence.Boolean( field_number );
+}
+
+inline void parse_field( const SENTENCE& sentence, int field_number, NORTHSOUTH& value )
+{
+   value = sentence.NorthOrSouth( field_number );
+}
+
+inline void parse_field( const SENTENCE& sentence, int field_number, EASTWEST& value )
+{
+   value = sentence.EastOrWest( field_number );
+}
+
+inline void parse_field( const SENTENCE& sentence, int field_number, LEFTRIGHT& value )
+{
+   value = sentence.LeftOrRight( field_number );
+}
+
+inline void parse_field( const SENTENCE& sentence, int field_number, LATLONG& value )
+{
+   value.Parse( field_number, field_number + 1, field_number + 2, field_number + 3, sentence );
+}
+
+/*
+** Unit letters, fields are otherwise written with the sink's own +=
+*/
+
+inline void write_unit( SENTENCE& sentence, char unit ) { sentence += wxString( (wxChar) unit ); }
+inline void write_unit( ENCODER& encoder, char unit )   { encoder.Unit( unit ); }
+
+inline void empty_field( double& value )           { value = 0.0; }
+inline void empty_field( int& value )              { value = 0; }
+inline void empty_field( wxString& value )         { value.Empty(); }
+inline void empty_field( NMEA0183_BOOLEAN& value ) { value = Unknown0183; }
+inline void empty_field( NORTHSOUTH& value )       { value = NS_Unknown; }
+inline void empty_field( EASTWEST& value )         { value = EW_Unknown; }
+inline void empty_field( LEFTRIGHT& value )        { value = LR_Unknown; }
+inline void empty_field( LATLONG& value )          { value.Empty(); }
+
+/*
+** Number of sentence fields a member takes up
+*/
+
+template< typename MEMBER > struct NMEA0183_FIELD_WIDTH  { enum { Value = 1 }; };
+template<> struct NMEA0183_FIELD_WIDTH< LATLONG >        { enum { Value = 4 }; };
+
+/*
+** A data member of the response class
+*/
+
+template< typename RESPONSE_TYPE, typename MEMBER, MEMBER RESPONSE_TYPE::*member, int field_number >
+struct NMEA0183_MEMBER_FIELD
+{
+   enum { Number = field_number, Width = NMEA0183_FIELD_WIDTH< MEMBER >::Value };
+
+   static void Parse( const SENTENCE& sentence, RESPONSE_TYPE& response )
+   {
+      parse_field( sentence, field_number, response.*member );
+   }
+
+   template< typename SINK > static void Write( SINK& sink, RESPONSE_TYPE& response )
+   {
+      sink += response.*member;
+   }
+
+   static void Empty( RESPONSE_TYPE& response )
+   {
+      empty_field( response.*member );
+   }
+
+   static void Copy( RESPONSE_TYPE& destination, const RESPONSE_TYPE& source )
+   {
+      destination.*member = source.*member;
+   }
+};
+
+/*
+** A fixed unit letter (T, M, N, K...) that is written but not kept
+*/
+
+template< int field_number, char unit >
+struct NMEA0183_UNIT_FIELD
+{
+   enum { Number = field_number, Width = 1 };
+
+   template< typename RESPONSE_TYPE > static void Parse( const SENTENCE&, RESPONSE_TYPE& ) {}
+   template< typename RESPONSE_TYPE > static void Empty( RESPONSE_TYPE& ) {}
+   template< typename RESPONSE_TYPE > static void Copy( RESPONSE_TYPE&, const RESPONSE_TYPE& ) {}
+
+   template< typename SINK, typename RESPONSE_TYPE > static void Write( SINK& sink, RESPONSE_TYPE& )
+   {
+      write_unit( sink, unit );
+   }
+};
+
+#define NMEA0183_FIELD( class_name, member, field_number ) \
+   NMEA0183_MEMBER_FIELD< class_name, decltype( class_name::member ), &class_name::member, field_number >
+
+#define NMEA0183_UNIT( field_number, unit ) NMEA0183_UNIT_FIELD< field_number, unit >
+
+/*
+** The field list itself, each step hands the rest of the list the
+** field number it has to start at
+*/
+
+template< int field_number, typename... FIELDS >
+struct NMEA0183_FIELD_LIST
+{
+   enum { End = field_number };
+
+   template< typename RESPONSE_TYPE > static void Parse( const SENTENCE&, RESPONSE_TYPE& ) {}
+   template< typename SINK, typename RESPONSE_TYPE > static void Write( SINK&, RESPONSE_TYPE& ) {}
+   template< typename RESPONSE_TYPE > static void Empty( RESPONSE_TYPE& ) {}
+   template< typename RESPONSE_TYPE > static void Copy( RESPONSE_TYPE&, const RESPONSE_TYPE& ) {}
+};
+
+template< int field_number, typename FIELD, typename... REST >
+struct NMEA0183_FIELD_LIST< field_number, FIELD, REST... >
+{
+   static_assert( FIELD::Number == field_number, "schema fields must be listed in order without gaps" );
+
+   typedef NMEA0183_FIELD_LIST< field_number + FIELD::Width, REST... > NEXT;
+
+   enum { End = NEXT::End };
+
+   template< typename RESPONSE_TYPE > static void Parse( const SENTENCE& sentence, RESPONSE_TYPE& response )
+   {
+      FIELD::Parse( sentence, response );
+      NEXT::Parse( sentence, response );
+   }
+
+   template< typename SINK, typename RESPONSE_TYPE > static void Write( SINK& sink, RESPONSE_TYPE& response )
+   {
+      FIELD::Write( sink, response );
+      NEXT::Write( sink, response );
+   }
+
+   template< typename RESPONSE_TYPE > static void Empty( RESPONSE_TYPE& response )
+   {
+      FIELD::Empty( response );
+      NEXT::Empty( response );
+   }
+
+   template< typename RESPONSE_TYPE > static void Copy( RESPONSE_TYPE& destination, const RESPONSE_TYPE& source )
+   {
+      FIELD::Copy( destination, source );
+      NEXT::Copy( destination, source );
+   }
+};
+
+/*
+** Field 0 is the address ($--HDT), data starts at 1.  End is the number
+** of the field after the last, where the checksum goes.
+*/
+
+template< typename... FIELDS >
+struct NMEA0183_SCHEMA : public NMEA0183_FIELD_LIST< 1, FIELDS... >
+{
+};
+
+#endif // SCHEMA_CLASS_HEADER
@@ -43,39 +43,118 @@
 
 class LATLONG;
 
+/*
+** Longest sentence accepted, tag block included, the standard allows 82
+** characters so this leaves room for tag blocks and sloppy talkers.  A
+** longer one is refused as oversized rather than cut short.
+*/
+
+#define NMEA0183_MAX_SENTENCE_LENGTH 255
+
+/*
+** Upper bound on the number of fields that are indexed in one sentence.
+** Every field after the first follows a separator, so a sentence within
+** NMEA0183_MAX_SENTENCE_LENGTH can not have more than this.
+*/
+
+#define NMEA0183_MAX_FIELDS NMEA0183_MAX_SENTENCE_LENGTH
+
 class SENTENCE 
 {
 //   DECLARE_DYNAMIC( SENTENCE )
 
+   private:
+
+      /*
+      ** The fields are read from 7 bit ASCII bytes.  Those are either the
+      ** caller's own buffer (see Assign) or Sentence converted once into
+      ** text_buffer, which holds one character too many so a sentence past
+      ** the limit can be told from one at it.
+      */
+
+      mutable const char *text;
+      mutable int text_length;
+      mutable bool text_is_sentence;
+      mutable char text_buffer[ NMEA0183_MAX_SENTENCE_LENGTH + 2 ];
+
+      /*
+      ** An NMEA 4 tag block in front of the sentence, text starts after it.
+      ** Points at what is between the two '\' characters.
+      */
+
+      mutable const char *tag_block;
+      mutable int tag_block_length;
+
+      /*
+      ** Start offsets (into text) of every field, built in one pass the
+      ** first time a field is asked for after the sentence changes.
+      ** field_offset[ number_of_fields ] is one past the separator that
+      ** would follow the last field.
+      */
+
+      mutable bool fields_indexed;
+      mutable bool oversized; // Longer than NMEA0183_MAX_SENTENCE_LENGTH, refused
+      mutable int number_of_fields;
+      mutable int checksum_field;
+      mutable unsigned short field_offset[ NMEA0183_MAX_FIELDS + 1 ];
+
+      /*
+      ** The checksum is verified at most once per sentence
+      */
+
+      mutable bool checksum_verified;
+      mutable NMEA0183_BOOLEAN checksum_bad;
+      NMEA0183_CHECKSUM_MODE checksum_mode;
+
+      void index_fields( void ) const;
+      int field_length( int field_number ) const;
+      char single_character( int field_number ) const;
+      int copy_field( int field_number, char *buffer, int buffer_size ) const;
+
    public:
 
       SENTENCE();
+      SENTENCE( const SENTENCE& source );
       virtual ~SENTENCE();
 
       /*
       ** Data
       */
 
-      wxString Sentence;
+      wxString Sentence; // Not kept up to date by Assign()
 
       /*
       ** Methods
       */
 
+      void Assign( const char *data, int length );
+      const char *Data( void ) const;
+      int Length( void ) const;
       virtual NMEA0183_BOOLEAN Boolean( int field_number ) const;
       virtual unsigned char ComputeChecksum( void ) const;
       virtual COMMUNICATIONS_MODE CommunicationsMode( int field_number ) const;
       virtual double Double( int field_number ) const;
+      NMEA0183_FIELD_STATUS Double( int field_number, double& value ) const;
+      NMEA0183_FIELD_STATUS Coordinate( int field_number, int maximum_degrees, int& degrees_e7 ) const;
       virtual EASTWEST EastOrWest( int field_number ) const;
-      virtual const wxString& Field( int field_number ) const;
+      virtual wxString Field( int field_number ) const;
+      void Field( int field_number, wxString& value ) const;
+      int FieldData( int field_number, const char *& data ) const;
+      bool IsOversized( void ) const;
+      int TagBlock( const char *& data ) const;
       virtual void Finish( void );
       virtual int GetNumberOfDataFields( void ) const;
       virtual int Integer( int field_number ) const;
+      NMEA0183_FIELD_STATUS Integer( int field_number, int& value ) const;
       virtual NMEA0183_BOOLEAN IsChecksumBad( int checksum_field_number ) const;
+      NMEA0183_BOOLEAN IsChecksumBad( void ) const;
+      NMEA0183_CHECKSUM_MODE GetChecksumMode( void ) const;
+      void SetChecksumMode( NMEA0183_CHECKSUM_MODE mode );
       virtual LEFTRIGHT LeftOrRight( int field_number ) const;
       virtual NORTHSOUTH NorthOrSouth( int field_number ) const;
       virtual REFERENCE Reference( int field_number ) const;
       virtual TRANSDUCER_TYPE TransducerType( int field_number ) const;
+      unsigned int MnemonicKey( void ) const;
 
       /*
       ** Operators
@@ -90,6 +169,7 @@ class SENTENCE
       virtual const SENTENCE& operator += ( COMMUNICATIONS_MODE mode );
       virtual const SENTENCE& operator += ( int value );
       virtual const SENTENCE& operator += ( EASTWEST easting );
+      virtual const SENTENCE& operator += ( LEFTRIGHT left_or_right );
       virtual const SENTENCE& operator += ( TRANSDUCER_TYPE transducer );
       virtual const SENTENCE& operator += ( NMEA0183_BOOLEAN boolean );
       virtual const SENTENCE& operator += ( LATLONG& source );
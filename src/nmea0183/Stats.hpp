@@ -0,0 +1,93 @@
+/***************************************************************************
+ *
+ * Project:  OpenCPN
+ * Purpose:  NMEA0183 Support Classes
+ * Author:   Sean D'Epagnier
+ *
+ ***************************************************************************
+ *   Copyright (C) 2018 by Sean D'Epagnier                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.             *
+ ***************************************************************************
+ */
+
+
+#if ! defined( PARSE_STATISTICS_CLASS_HEADER )
+#define PARSE_STATISTICS_CLASS_HEADER
+
+/*
+** Counters NMEA0183 keeps for every sentence type it is handed.  Counting
+** is a few increments per sentence and always on, timing the parsers is
+** optional and sampled:
+**
+**    nmea.Statistics.TimingInterval = 100; // Time one parse in a hundred
+**
+** A sentence only counts once however often PreParse() and Parse() are
+** called for it.  Sentence[ SID_Unknown ] holds the mnemonics nobody
+** parses, everything received there was rejected.
+*/
+
+#define NMEA0183_TIMING_BUCKETS 16 // Parse time histogram, see BucketLimit()
+
+typedef struct
+{
+   unsigned long      Received;
+   unsigned long      Parsed;
+   unsigned long      ChecksumRejects; // Bad, or missing in ChecksumStrict mode
+   unsigned long      FieldErrors;     // The response class refused the fields
+   unsigned long long Bytes;
+
+   unsigned long      TimedParses;
+   unsigned long long TimedNanoseconds;
+   unsigned long      ParseTime[ NMEA0183_TIMING_BUCKETS ];
+} SENTENCE_STATISTICS;
+
+class PARSE_STATISTICS
+{
+   private:
+
+      int parses_until_timed;
+
+   public:
+
+      PARSE_STATISTICS();
+      virtual ~PARSE_STATISTICS();
+
+      /*
+      ** Data
+      */
+
+      SENTENCE_STATISTICS Sentence[ SID_Count ];
+      unsigned long NotSentences; // Did not start with '$'
+      unsigned long Oversized;    // Too long to index, see SENTENCE::IsOversized()
+
+      int TimingInterval; // Time every this many parses, 0 for never
+
+      /*
+      ** Methods
+      */
+
+      void Reset( void );
+      void Total( SENTENCE_STATISTICS& total ) const;
+      void Add( const PARSE_STATISTICS& other );
+      bool StartTiming( void );
+      void AddParseTime( SENTENCE_ID sentence_id, unsigned long long nanoseconds );
+
+      static unsigned long long Nanoseconds( void );
+      static unsigned long long BucketLimit( int bucket );
+};
+
+#endif // PARSE_STATISTICS_CLASS_HEADER
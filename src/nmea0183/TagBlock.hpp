@@ -0,0 +1,76 @@
+/***************************************************************************
+ *
+ * Project:  OpenCPN
+ * Purpose:  NMEA0183 Support Classes
+ * Author:   Sean D'Epagnier
+ *
+ ***************************************************************************
+ *   Copyright (C) 2018 by Sean D'Epagnier                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.             *
+ ***************************************************************************
+ */
+
+
+#if ! defined( TAG_BLOCK_CLASS_HEADER )
+#define TAG_BLOCK_CLASS_HEADER
+
+/*
+** NMEA 0183 version 4 tag block, the "\s:GW0001,c:1546300800*5A\" some
+** gateways put in front of a sentence to say where and when it came from.
+**
+**    s: source           c: UNIX time        n: line count
+**    g: group (sentence-of-sentences-group id)
+**
+** Anything else (d:, r:, t:) is skipped.  A tag block with a bad checksum
+** is treated as if it were not there.
+*/
+
+#define TAG_BLOCK_SOURCE_LENGTH 15
+
+class TAG_BLOCK
+{
+   public:
+
+      TAG_BLOCK();
+      virtual ~TAG_BLOCK();
+
+      /*
+      ** Data
+      */
+
+      bool   Present;
+      char   Source[ TAG_BLOCK_SOURCE_LENGTH + 1 ]; // Empty if not sent
+      double Time;      // Seconds since 1970, NAN if not sent
+      double TimeResolution; // Seconds, 1 for whole seconds, NAN if not sent
+      int    LineCount; // -1 if not sent
+      int    GroupSentence;  // 1 based, 0 if not sent
+      int    GroupSentences;
+      int    GroupID;
+
+      unsigned long BadChecksums;
+
+      /*
+      ** Methods
+      */
+
+      void Empty( void );
+      bool Parse( const SENTENCE& sentence );
+      bool Parse( const char *data, int length );
+      bool HasTime( void ) const;
+};
+
+#endif // TAG_BLOCK_CLASS_HEADER
@@ -0,0 +1,902 @@
+/***************************************************************************
+ *
+ * Project:  OpenCPN
+ * Purpose:  NMEA0183 Support Classes
+ * Author:   Sean D'Epagnier
+ *
+ ***************************************************************************
+ *   Copyright (C) 2018 by Sean D'Epagnier                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.             *
+ ***************************************************************************
+ */
+
+
+
+#include "nmea0183.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <functional>
+#include <thread>
+
+#if defined( _WIN32 )
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/*
+** Pieces smaller than this are not worth a thread of their own
+*/
+
+#define BULK_MINIMUM_PIECE_SIZE ( 1024 * 1024 )
+
+/*
+** Column helpers
+*/
+
+template< typename TYPE > static bool grow_column( TYPE *& column, size_t rows )
+{
+   TYPE *new_column = (TYPE *) ::realloc( column, rows * sizeof( TYPE ) );
+
+   if ( new_column == NULL )
+   {
+      return( false );
+   }
+
+   column = new_column;
+
+   return( true );
+}
+
+template< typename TYPE > static void copy_column( TYPE *destination, const TYPE *source, size_t rows )
+{
+   if ( rows > 0 )
+   {
+      ::memcpy( destination, source, rows * sizeof( TYPE ) );
+   }
+}
+
+static void copy_row( BULK_COLUMNS& destination, size_t to, const BULK_COLUMNS& source, size_t from )
+{
+   destination.Time[ to ]              = source.Time[ from ];
+   destination.Sentence[ to ]          = source.Sentence[ from ];
+   destination.HeadingTrue[ to ]       = source.HeadingTrue[ from ];
+   destination.CourseTrue[ to ]        = source.CourseTrue[ from ];
+   destination.SpeedKnots[ to ]        = source.SpeedKnots[ from ];
+   destination.ApparentWindAngle[ to ] = source.ApparentWindAngle[ from ];
+   destination.ApparentWindSpeed[ to ] = source.ApparentWindSpeed[ from ];
+   destination.TrueWindAngle[ to ]     = source.TrueWindAngle[ from ];
+   destination.TrueWindSpeed[ to ]     = source.TrueWindSpeed[ from ];
+   destination.Latitude[ to ]          = source.Latitude[ from ];
+   destination.Longitude[ to ]         = source.Longitude[ from ];
+}
+
+/*
+** Rows from before the log says what time it is sort first
+*/
+
+static inline double time_key( double time )
+{
+   return( ::isnan( time ) ? -HUGE_VAL : time );
+}
+
+BULK_COLUMNS::BULK_COLUMNS()
+{
+   capacity          = 0;
+   Count             = 0;
+   Time              = NULL;
+   Sentence          = NULL;
+   HeadingTrue       = NULL;
+   CourseTrue        = NULL;
+   SpeedKnots        = NULL;
+   ApparentWindAngle = NULL;
+   ApparentWindSpeed = NULL;
+   TrueWindAngle     = NULL;
+   TrueWindSpeed     = NULL;
+   Latitude          = NULL;
+   Longitude         = NULL;
+}
+
+BULK_COLUMNS::~BULK_COLUMNS()
+{
+   ::free( Time );
+   ::free( Sentence );
+   ::free( HeadingTrue );
+   ::free( CourseTrue );
+   ::free( SpeedKnots );
+   ::free( ApparentWindAngle );
+   ::free( ApparentWindSpeed );
+   ::free( TrueWindAngle );
+   ::free( TrueWindSpeed );
+   ::free( Latitude );
+   ::free( Longitude );
+}
+
+bool BULK_COLUMNS::reserve( size_t rows )
+{
+   if ( rows <= capacity )
+   {
+      return( true );
+   }
+
+   size_t new_capacity = ( capacity > 0 ) ? capacity : 1024;
+
+   while( new_capacity < rows )
+   {
+      new_capacity *= 2;
+   }
+
+   /*
+   ** A column that grew before another failed is merely roomier than it
+   ** needs to be
+   */
+
+   if ( ! grow_column( Time, new_capacity )              ||
+        ! grow_column( Sentence, new_capacity )          ||
+        ! grow_column( HeadingTrue, new_capacity )       ||
+        ! grow_column( CourseTrue, new_capacity )        ||
+        ! grow_column( SpeedKnots, new_capacity )        ||
+        ! grow_column( ApparentWindAngle, new_capacity ) ||
+        ! grow_column( ApparentWindSpeed, new_capacity ) ||
+        ! grow_column( TrueWindAngle, new_capacity )     ||
+        ! grow_column( TrueWindSpeed, new_capacity )     ||
+        ! grow_column( Latitude, new_capacity )          ||
+        ! grow_column( Longitude, new_capacity ) )
+   {
+      return( false );
+   }
+
+   capacity = new_capacity;
+
+   return( true );
+}
+
+void BULK_COLUMNS::Clear( void )
+{
+   Count = 0;
+}
+
+int BULK_COLUMNS::AddRow( double time, SENTENCE_ID sentence_id )
+{
+   if ( ! reserve( Count + 1 ) )
+   {
+      return( -1 );
+   }
+
+   Time[ Count ]              = time;
+   Sentence[ Count ]          = (unsigned char) sentence_id;
+   HeadingTrue[ Count ]       = NAN;
+   CourseTrue[ Count ]        = NAN;
+   SpeedKnots[ Count ]        = NAN;
+   ApparentWindAngle[ Count ] = NAN;
+   ApparentWindSpeed[ Count ] = NAN;
+   TrueWindAngle[ Count ]     = NAN;
+   TrueWindSpeed[ Count ]     = NAN;
+   Latitude[ Count ]          = NAN;
+   Longitude[ Count ]         = NAN;
+
+   return( (int) Count++ );
+}
+
+bool BULK_COLUMNS::Append( const BULK_COLUMNS& source )
+{
+   if ( ! reserve( Count + source.Count ) )
+   {
+      return( false );
+   }
+
+   copy_column( Time + Count,              source.Time,              source.Count );
+   copy_column( Sentence + Count,          source.Sentence,          source.Count );
+   copy_column( HeadingTrue + Count,       source.HeadingTrue,       source.Count );
+   copy_column( CourseTrue + Count,        source.CourseTrue,        source.Count );
+   copy_column( SpeedKnots + Count,        source.SpeedKnots,        source.Count );
+   copy_column( ApparentWindAngle + Count, source.ApparentWindAngle, source.Count );
+   copy_column( ApparentWindSpeed + Count, source.ApparentWindSpeed, source.Count );
+   copy_column( TrueWindAngle + Count,     source.TrueWindAngle,     source.Count );
+   copy_column( TrueWindSpeed + Count,     source.TrueWindSpeed,     source.Count );
+   copy_column( Latitude + Count,          source.Latitude,          source.Count );
+   copy_column( Longitude + Count,         source.Longitude,         source.Count );
+
+   Count += source.Count;
+
+   return( true );
+}
+
+bool BULK_COLUMNS::Merge( const BULK_COLUMNS& source )
+{
+   /*
+   ** Logs of different instruments over the same voyage say, rows of
+   ** the same time keep ours first
+   */
+
+   BULK_COLUMNS merged;
+
+   if ( ! merged.reserve( Count + source.Count ) )
+   {
+      return( false );
+   }
+
+   size_t ours   = 0;
+   size_t theirs = 0;
+
+   while( ours < Count || theirs < source.Count )
+   {
+      if ( theirs == source.Count ||
+         ( ours < Count && time_key( Time[ ours ] ) <= time_key( source.Time[ theirs ] ) ) )
+      {
+         copy_row( merged, merged.Count++, *this, ours++ );
+      }
+      else
+      {
+         copy_row( merged, merged.Count++, source, theirs++ );
+      }
+   }
+
+   Swap( merged );
+
+   return( true );
+}
+
+bool BULK_COLUMNS::IsSortedByTime( void ) const
+{
+   for( size_t row = 1; row < Count; row++ )
+   {
+      if ( time_key( Time[ row ] ) < time_key( Time[ row - 1 ] ) )
+      {
+         return( false );
+      }
+   }
+
+   return( true );
+}
+
+bool BULK_COLUMNS::SortByTime( void )
+{
+   if ( IsSortedByTime() )
+   {
+      return( true );
+   }
+
+   size_t *order = (size_t *) ::malloc( Count * sizeof( size_t ) );
+
+   BULK_COLUMNS sorted;
+
+   if ( order == NULL || ! sorted.reserve( Count ) )
+   {
+      ::free( order );
+      return( false );
+   }
+
+   for( size_t row = 0; row < Count; row++ )
+   {
+      order[ row ] = row;
+   }
+
+   /*
+   ** Stable, so sentences that share a time stay in log order
+   */
+
+   const double *time = Time;
+
+   std::stable_sort( order, order + Count, [ time ]( size_t a, size_t b )
+   {
+      return( time_key( time[ a ] ) < time_key( time[ b ] ) );
+   } );
+
+   for( size_t row = 0; row < Count; row++ )
+   {
+      copy_row( sorted, row, *this, order[ row ] );
+   }
+
+   sorted.Count = Count;
+
+   ::free( order );
+
+   Swap( sorted );
+
+   return( true );
+}
+
+void BULK_COLUMNS::Swap( BULK_COLUMNS& other )
+{
+   std::swap( capacity,          other.capacity );
+   std::swap( Count,             other.Count );
+   std::swap( Time,              other.Time );
+   std::swap( Sentence,          other.Sentence );
+   std::swap( HeadingTrue,       other.HeadingTrue );
+   std::swap( CourseTrue,        other.CourseTrue );
+   std::swap( SpeedKnots,        other.SpeedKnots );
+   std::swap( ApparentWindAngle, other.ApparentWindAngle );
+   std::swap( ApparentWindSpeed, other.ApparentWindSpeed );
+   std::swap( TrueWindAngle,     other.TrueWindAngle );
+   std::swap( TrueWindSpeed,     other.TrueWindSpeed );
+   std::swap( Latitude,          other.Latitude );
+   std::swap( Longitude,         other.Longitude );
+}
+
+/*
+** Decoding
+*/
+
+/*
+** What one thread makes of its piece of the log
+*/
+
+typedef struct
+{
+   const char  *begin;
+   const char  *end;
+   BULK_COLUMNS columns;
+   size_t       untimed_rows; // Rows before the piece found a time of its own
+   double       last_time;    // The time at the end of the piece, NAN if none
+   unsigned long long lines;
+   bool         out_of_memory;
+   PARSE_STATISTICS statistics;
+} BULK_PIECE;
+
+/*
+** Days since 1970-01-01 of a date in the Gregorian calendar
+*/
+
+static long days_from_civil( int year, int month, int day )
+{
+   year -= ( month <= 2 );
+
+   long era = ( year >= 0 ? year : year - 399 ) / 400;
+   long year_of_era = year - era * 400;
+   long day_of_year = ( 153 * ( month + ( month > 2 ? -3 : 9 ) ) + 2 ) / 5 + day - 1;
+   long day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+
+   return( era * 146097 + day_of_era - 719468 );
+}
+
+/*
+** hhmmss.ss on a day to seconds since 1970, NAN if it is not a time
+*/
+
+static double utc_seconds( const wxString& utc_time, int year, int month, int day )
+{
+   char   characters[ 16 ];
+   int    length = (int) utc_time.Len();
+   double hhmmss = 0.0;
+
+   if ( length < 6 || length >= (int) sizeof( characters ) ||
+        year < 1970 || month < 1 || month > 12 || day < 1 || day > 31 )
+   {
+      return( NAN );
+   }
+
+   for( int index = 0; index < length; index++ )
+   {
+      characters[ index ] = (char) utc_time[ index ];
+   }
+
+   if ( decode_double( characters, length, hhmmss ) != FieldValid || hhmmss < 0.0 )
+   {
+      return( NAN );
+   }
+
+   int hours   = (int) ( hhmmss / 10000.0 );
+   int minutes = (int) ( hhmmss / 100.0 ) % 100;
+
+   return( days_from_civil( year, month, day ) * 86400.0 +
+           hours * 3600.0 + minutes * 60.0 + ( hhmmss - hours * 10000.0 - minutes * 100.0 ) );
+}
+
+static int two_digits( const wxString& text, int index )
+{
+   wxChar tens = text[ index ];
+   wxChar ones = text[ index + 1 ];
+
+   if ( tens < '0' || tens > '9' || ones < '0' || ones > '9' )
+   {
+      return( -1 );
+   }
+
+   return( ( tens - '0' ) * 10 + ( ones - '0' ) );
+}
+
+static double rmc_time( const RMC& rmc )
+{
+   /*
+   ** ddmmyy, a two digit year from before 1980 is taken as 20xx
+   */
+
+   if ( rmc.Date.Len() != 6 )
+   {
+      return( NAN );
+   }
+
+   int day   = two_digits( rmc.Date, 0 );
+   int month = two_digits( rmc.Date, 2 );
+   int year  = two_digits( rmc.Date, 4 );
+
+   if ( day < 0 || month < 0 || year < 0 )
+   {
+      return( NAN );
+   }
+
+   return( utc_seconds( rmc.UTCTime, ( year < 80 ) ? 2000 + year : 1900 + year, month, day ) );
+}
+
+static float knots( double speed, const wxString& units )
+{
+   if ( units == _T("K") )
+   {
+      return( (float) ( speed / 1.852 ) );
+   }
+
+   if ( units == _T("M") )
+   {
+      return( (float) ( speed * 3600.0 / 1852.0 ) );
+   }
+
+   if ( units == _T("S") )
+   {
+      return( (float) ( speed * 1609.344 / 1852.0 ) );
+   }
+
+   return( (float) speed );
+}
+
+static void decode_piece( BULK_PIECE& piece, const bool *selected, int timing_interval )
+{
+   NMEA0183 nmea;
+
+   nmea.Statistics.TimingInterval = timing_interval;
+
+   bool   timed = false;
+   double clock = NAN;
+
+   for( const char *line = piece.begin; line < piece.end; )
+   {
+      const char *newline = (const char *) ::memchr( line, '\n', piece.end - line );
+      const char *line_end = ( newline != NULL ) ? newline : piece.end;
+      const char *next = ( newline != NULL ) ? newline + 1 : piece.end;
+
+      int length = (int) ( line_end - line );
+
+      while( length > 0 && line[ length - 1 ] == '\r' )
+      {
+         length--;
+      }
+
+      piece.lines++;
+
+      if ( length == 0 || length > NMEA0183_MAX_SENTENCE_LENGTH )
+      {
+         line = next;
+         continue;
+      }
+
+      /*
+      ** Screen on the address before anything is parsed, only the
+      ** selected sentences, the ones that tell the time and those with a
+      ** tag block (which might) go any further
+      */
+
+      const char *address = line;
+      bool tagged = ( line[ 0 ] == '\\' );
+
+      if ( tagged )
+      {
+         const char *tag_end = (const char *) ::memchr( line + 1, '\\', length - 1 );
+
+         address = ( tag_end != NULL ) ? tag_end + 1 : line + length;
+      }
+
+      SENTENCE_ID sentence_id = SID_Unknown;
+
+      if ( line + length - address >= 6 && ( address[ 0 ] == '$' || address[ 0 ] == '!' ) )
+      {
+         sentence_id = nmea.Identify( NMEA0183_MNEMONIC_KEY( address[ 3 ], address[ 4 ], address[ 5 ] ) );
+      }
+
+      bool wanted = selected[ sentence_id ];
+      bool clock_source = ( sentence_id == SID_RMC || sentence_id == SID_ZDA );
+
+      if ( ! wanted && ! clock_source && ! tagged )
+      {
+         line = next;
+         continue;
+      }
+
+      nmea.Assign( line, length );
+
+      bool parsed = nmea.Parse();
+
+      if ( nmea.TagBlock.HasTime() )
+      {
+         clock = nmea.TagBlock.Time;
+      }
+      else if ( parsed && sentence_id == SID_RMC )
+      {
+         double time = rmc_time( nmea.Rmc );
+
+         if ( ! ::isnan( time ) )
+         {
+            clock = time;
+         }
+      }
+      else if ( parsed && sentence_id == SID_ZDA )
+      {
+         double time = utc_seconds( nmea.Zda.UTCTime, nmea.Zda.Year, nmea.Zda.Month, nmea.Zda.Day );
+
+         if ( ! ::isnan( time ) )
+         {
+            clock = time;
+         }
+      }
+
+      if ( ! timed && ! ::isnan( clock ) )
+      {
+         timed = true;
+         piece.untimed_rows = piece.columns.Count;
+      }
+
+      if ( wanted && parsed )
+      {
+         BULK_COLUMNS& columns = piece.columns;
+
+         int row = columns.AddRow( clock, sentence_id );
+
+         if ( row < 0 )
+         {
+            piece.out_of_memory = true;
+            break;
+         }
+
+         switch( sentence_id )
+         {
+            case SID_HDT:
+
+               columns.HeadingTrue[ row ] = (float) nmea.Hdt.DegreesTrue;
+               break;
+
+            case SID_RMC:
+
+               if ( nmea.Rmc.IsDataValid == NTrue )
+               {
+                  columns.CourseTrue[ row ] = (float) nmea.Rmc.TrackMadeGoodDegreesTrue;
+                  columns.SpeedKnots[ row ] = (float) nmea.Rmc.SpeedOverGroundKnots;
+                  columns.Latitude[ row ]   = nmea.Rmc.Position.Latitude.DegreesE7 / 1e7;
+                  columns.Longitude[ row ]  = nmea.Rmc.Position.Longitude.DegreesE7 / 1e7;
+               }
+
+               break;
+
+            case SID_VTG:
+
+               columns.CourseTrue[ row ] = (float) nmea.Vtg.TrackDegreesTrue;
+               columns.SpeedKnots[ row ] = (float) nmea.Vtg.SpeedKnots;
+               break;
+
+            case SID_MWV:
+
+               if ( nmea.Mwv.IsDataValid == NTrue )
+               {
+                  float speed = knots( nmea.Mwv.WindSpeed, nmea.Mwv.WindSpeedUnits );
+
+                  if ( nmea.Mwv.Reference == _T("R") )
+                  {
+                     columns.ApparentWindAngle[ row ] = (float) nmea.Mwv.WindAngle;
+                     columns.ApparentWindSpeed[ row ] = speed;
+                  }
+                  else if ( nmea.Mwv.Reference == _T("T") )
+                  {
+                     columns.TrueWindAngle[ row ] = (float) nmea.Mwv.WindAngle;
+                     columns.TrueWindSpeed[ row ] = speed;
+                  }
+               }
+
+               break;
+
+            default:
+
+               break;
+         }
+      }
+
+      line = next;
+   }
+
+   if ( ! timed )
+   {
+      piece.untimed_rows = piece.columns.Count;
+   }
+
+   piece.last_time = clock;
+   piece.statistics.Add( nmea.Statistics );
+}
+
+BULK_DECODER::BULK_DECODER()
+{
+   Threads = 0;
+   Lines   = 0;
+   Deselect();
+}
+
+BULK_DECODER::~BULK_DECODER()
+{
+}
+
+bool BULK_DECODER::Select( SENTENCE_ID sentence_id )
+{
+   switch( sentence_id )
+   {
+      case SID_HDT:
+      case SID_MWV:
+      case SID_RMC:
+      case SID_VTG:
+
+         selected[ sentence_id ] = true;
+         return( true );
+
+      default:
+
+         return( false );
+   }
+}
+
+void BULK_DECODER::Deselect( void )
+{
+   for( int index = 0; index < SID_Count; index++ )
+   {
+      selected[ index ] = false;
+   }
+}
+
+bool BULK_DECODER::IsSelected( SENTENCE_ID sentence_id ) const
+{
+   if ( sentence_id < 0 || sentence_id >= SID_Count )
+   {
+      return( false );
+   }
+
+   return( selected[ sentence_id ] );
+}
+
+bool BULK_DECODER::Decode( const char *data, size_t length, BULK_COLUMNS& columns )
+{
+   columns.Clear();
+   Lines = 0;
+   Statistics.Reset();
+
+   /*
+   ** One piece per thread, each ends just after a newline so no sentence
+   ** is cut in two
+   */
+
+   size_t number_of_pieces = ( Threads > 0 ) ? (size_t) Threads : std::thread::hardware_concurrency();
+
+   if ( number_of_pieces < 1 )
+   {
+      number_of_pieces = 1;
+   }
+
+   if ( number_of_pieces > length / BULK_MINIMUM_PIECE_SIZE + 1 )
+   {
+      number_of_pieces = length / BULK_MINIMUM_PIECE_SIZE + 1;
+   }
+
+   BULK_PIECE *pieces = new BULK_PIECE[ number_of_pieces ];
+
+   const char *end = data + length;
+   const char *begin = data;
+
+   for( size_t index = 0; index < number_of_pieces; index++ )
+   {
+      const char *piece_end = ( index + 1 == number_of_pieces ) ? end : data + length / number_of_pieces * ( index + 1 );
+
+      if ( piece_end < begin )
+      {
+         piece_end = begin;
+      }
+
+      if ( piece_end < end )
+      {
+         const char *newline = (const char *) ::memchr( piece_end, '\n', end - piece_end );
+
+         piece_end = ( newline != NULL ) ? newline + 1 : end;
+      }
+
+      pieces[ index ].begin         = begin;
+      pieces[ index ].end           = piece_end;
+      pieces[ index ].untimed_rows  = 0;
+      pieces[ index ].last_time     = NAN;
+      pieces[ index ].lines         = 0;
+      pieces[ index ].out_of_memory = false;
+
+      begin = piece_end;
+   }
+
+   /*
+   ** The first piece is decoded on this thread
+   */
+
+   std::thread *threads = new std::thread[ number_of_pieces ];
+
+   for( size_t index = 1; index < number_of_pieces; index++ )
+   {
+      threads[ index ] = std::thread( decode_piece, std::ref( pieces[ index ] ), selected, Statistics.TimingInterval );
+   }
+
+   decode_piece( pieces[ 0 ], selected, Statistics.TimingInterval );
+
+   for( size_t index = 1; index < number_of_pieces; index++ )
+   {
+      threads[ index ].join();
+   }
+
+   delete [] threads;
+
+   /*
+   ** A piece's first rows carry the time the piece before it ended on,
+   ** then the pieces go one after the other
+   */
+
+   bool   return_value = true;
+   double clock = NAN;
+
+   for( size_t index = 0; index < number_of_pieces; index++ )
+   {
+      BULK_PIECE& piece = pieces[ index ];
+
+      for( size_t row = 0; row < piece.untimed_rows; row++ )
+      {
+         piece.columns.Time[ row ] = clock;
+      }
+
+      if ( ! ::isnan( piece.last_time ) )
+      {
+         clock = piece.last_time;
+      }
+
+      if ( index == 0 )
+      {
+         columns.Swap( piece.columns );
+      }
+      else if ( ! columns.Append( piece.columns ) )
+      {
+         return_value = false;
+      }
+
+      if ( piece.out_of_memory )
+      {
+         return_value = false;
+      }
+
+      Lines += piece.lines;
+      Statistics.Add( piece.statistics );
+   }
+
+   delete [] pieces;
+
+   if ( ! return_value || ! columns.SortByTime() )
+   {
+      ErrorMessage = _T("Out of memory");
+      return( false );
+   }
+
+   return( true );
+}
+
+bool BULK_DECODER::Decode( const char *path, BULK_COLUMNS& columns )
+{
+   bool return_value = false;
+
+#if defined( _WIN32 )
+
+   HANDLE file = ::CreateFileA( path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                                FILE_FLAG_SEQUENTIAL_SCAN, NULL );
+
+   if ( file == INVALID_HANDLE_VALUE )
+   {
+      ErrorMessage = _T("Can not open ") + wxString::FromUTF8( path );
+      return( false );
+   }
+
+   LARGE_INTEGER size;
+
+   if ( ! ::GetFileSizeEx( file, &size ) )
+   {
+      ::CloseHandle( file );
+      ErrorMessage = _T("Can not read ") + wxString::FromUTF8( path );
+      return( false );
+   }
+
+   if ( size.QuadPart == 0 )
+   {
+      ::CloseHandle( file );
+      columns.Clear();
+      Lines = 0;
+      Statistics.Reset();
+      return( true );
+   }
+
+   HANDLE mapping = ::CreateFileMapping( file, NULL, PAGE_READONLY, 0, 0, NULL );
+   const char *data = ( mapping != NULL ) ? (const char *) ::MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 ) : NULL;
+
+   if ( data != NULL )
+   {
+      return_value = Decode( data, (size_t) size.QuadPart, columns );
+      ::UnmapViewOfFile( data );
+   }
+   else
+   {
+      ErrorMessage = _T("Can not map ") + wxString::FromUTF8( path );
+   }
+
+   if ( mapping != NULL )
+   {
+      ::CloseHandle( mapping );
+   }
+
+   ::CloseHandle( file );
+
+#else
+
+   int file = ::open( path, O_RDONLY );
+
+   if ( file < 0 )
+   {
+      ErrorMessage = _T("Can not open ") + wxString::FromUTF8( path );
+      return( false );
+   }
+
+   struct stat status;
+
+   if ( ::fstat( file, &status ) != 0 )
+   {
+      ::close( file );
+      ErrorMessage = _T("Can not read ") + wxString::FromUTF8( path );
+      return( false );
+   }
+
+   if ( status.st_size == 0 )
+   {
+      ::close( file );
+      columns.Clear();
+      Lines = 0;
+      Statistics.Reset();
+      return( true );
+   }
+
+   void *data = ::mmap( NULL, status.st_size, PROT_READ, MAP_PRIVATE, file, 0 );
+
+   if ( data != MAP_FAILED )
+   {
+      ::madvise( data, status.st_size, MADV_SEQUENTIAL );
+      return_value = Decode( (const char *) data, (size_t) status.st_size, columns );
+      ::munmap( data, status.st_size );
+   }
+   else
+   {
+      ErrorMessage = _T("Can not map ") + wxString::FromUTF8( path );
+   }
+
+   ::close( file );
+
+#endif
+
+   return( return_value );
+}
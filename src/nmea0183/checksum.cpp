@@ -0,0 +1,104 @@
+/***************************************************************************
+ *
+ * Project:  OpenCPN
+ * Purpose:  NMEA0183 Support Classes
+ * Author:   Sean D'Epagnier
+ *
+ ***************************************************************************
+ *   Copyright (C) 2018 by Sean D'Epagnier                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.             *
+ ***************************************************************************
+ */
+
+
+
+#include "nmea0183.h"
+
+#include <string.h>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#include <emmintrin.h>
+#define NMEA0183_CHECKSUM_SSE2
+#endif
+
+/*
+** The NMEA checksum is the exclusive or of every byte between the $ and
+** the *.  Exclusive or does not care about order, so the bytes are folded
+** a register at a time and the lanes of the register combined at the end.
+*/
+
+unsigned char compute_checksum( const char *data, int length )
+{
+   int index = 0;
+   unsigned char checksum_value = 0;
+
+   if ( data == NULL || length <= 0 )
+   {
+      return( 0 );
+   }
+
+#if defined( NMEA0183_CHECKSUM_SSE2 )
+
+   if ( length >= 16 )
+   {
+      __m128i fold = _mm_setzero_si128();
+
+      for( ; index + 16 <= length; index += 16 )
+      {
+         fold = _mm_xor_si128( fold, _mm_loadu_si128( (const __m128i *) ( data + index ) ) );
+      }
+
+      fold = _mm_xor_si128( fold, _mm_srli_si128( fold, 8 ) );
+      fold = _mm_xor_si128( fold, _mm_srli_si128( fold, 4 ) );
+      fold = _mm_xor_si128( fold, _mm_srli_si128( fold, 2 ) );
+      fold = _mm_xor_si128( fold, _mm_srli_si128( fold, 1 ) );
+
+      checksum_value = (unsigned char) _mm_cvtsi128_si32( fold );
+   }
+
+#else
+
+   if ( length >= (int) sizeof( unsigned long ) )
+   {
+      unsigned long fold = 0;
+
+      for( ; index + (int) sizeof( unsigned long ) <= length; index += sizeof( unsigned long ) )
+      {
+         unsigned long word;
+
+         ::memcpy( &word, data + index, sizeof( word ) ); // No alignment is assumed
+         fold ^= word;
+      }
+
+      for( unsigned int shift = sizeof( unsigned long ) * 4; shift >= 8; shift /= 2 )
+      {
+         fold ^= fold >> shift;
+      }
+
+      checksum_value = (unsigned char) fold;
+   }
+
+#endif
+
+   while( index < length )
+   {
+      checksum_value ^= (unsigned char) data[ index ];
+      index++;
+   }
+
+   return( checksum_value );
+}
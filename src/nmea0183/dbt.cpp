@@ -41,9 +41,22 @@
 
 //IMPLEMENT_DYNAMIC( DBT, RESPONSE )
 
+/*
+** Fields in sentence order
+*/
+
+typedef NMEA0183_SCHEMA<
+   NMEA0183_FIELD( DBT, DepthFeet, 1 ),
+   NMEA0183_UNIT( 2, 'f' ),
+   NMEA0183_FIELD( DBT, DepthMeters, 3 ),
+   NMEA0183_UNIT( 4, 'M' ),
+   NMEA0183_FIELD( DBT, DepthFathoms, 5 ),
+   NMEA0183_UNIT( 6, 'F' ) > DBT_SCHEMA;
+
 DBT::DBT()
 {
    Mnemonic = _T("DBT");
+   SentenceID = SID_DBT;
    Empty();
 }
 
@@ -57,9 +70,7 @@ void DBT::Empty( void )
 {
 //   ASSERT_VALID( this );
 
-   DepthFeet    = 0.0;
-   DepthMeters  = 0.0;
-   DepthFathoms = 0.0;
+   DBT_SCHEMA::Empty( *this );
 }
 
 bool DBT::Parse( const SENTENCE& sentence )
@@ -87,15 +98,13 @@ bool DBT::Parse( const SENTENCE& sentence )
    ** First we check the checksum...
    */
 
-   if ( sentence.IsChecksumBad( 7 ) == TRUE )
+   if ( sentence.IsChecksumBad( DBT_SCHEMA::End ) == TRUE )
    {
       SetErrorMessage( _T("Invalid Checksum") );
       return( FALSE );
    } 
 
-   DepthFeet    = sentence.Double( 1 );
-   DepthMeters  = sentence.Double( 3 );
-   DepthFathoms = sentence.Double( 5 );
+   DBT_SCHEMA::Parse( sentence, *this );
 
    return( TRUE );
 }
@@ -110,25 +119,29 @@ bool DBT::Write( SENTENCE& sentence )
    
    RESPONSE::Write( sentence );
 
-   sentence += DepthFeet;
-   sentence += _T("f");
-   sentence += DepthMeters;
-   sentence += _T("M");
-   sentence += DepthFathoms;
-   sentence += _T("F");
+   DBT_SCHEMA::Write( sentence, *this );
 
    sentence.Finish();
 
    return( TRUE );
 }
 
+int DBT::Encode( char *buffer, int buffer_size, unsigned short talker_code )
+{
+   ENCODER encoder( buffer, buffer_size );
+
+   RESPONSE::Write( encoder, talker_code );
+
+   DBT_SCHEMA::Write( encoder, *this );
+
+   return( encoder.Finish() );
+}
+
 const DBT& DBT::operator = ( const DBT& source )
 {
    //ASSERT_VALID( this );
 
-   DepthFeet    = source.DepthFeet;
-   DepthMeters  = source.DepthMeters;
-   DepthFathoms = source.DepthFathoms;
+   DBT_SCHEMA::Copy( *this, source );
 
    return( *this );
 }
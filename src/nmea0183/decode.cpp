@@ -0,0 +1,290 @@
+/***************************************************************************
+ *
+ * Project:  OpenCPN
+ * Purpose:  NMEA0183 Support Classes
+ * Author:   Sean D'Epagnier
+ *
+ ***************************************************************************
+ *   Copyright (C) 2018 by Sean D'Epagnier                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.             *
+ ***************************************************************************
+ */
+
+
+#include "nmea0183.h"
+#include <limits.h>
+
+/*
+** Numeric field decoding that does not depend on the C locale.  atof()
+** honours LC_NUMERIC, so on a system using ',' as decimal separator
+** "123.4" would silently decode as 123.
+*/
+
+/*
+** Powers of ten that are exactly representable as doubles
+*/
+
+static const double exact_powers_of_ten[] =
+{
+   1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+   1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+#define MAXIMUM_EXACT_POWER_OF_TEN 22
+#define MAXIMUM_EXACT_MANTISSA     9007199254740992ULL // 2^53
+
+/*
+** Splits [+|-]ddd[.ddd] into a sign, up to 19 significant digits and the
+** power of ten they are scaled by (negative when integer digits were dropped).
+** Spaces either side of the number are ignored.
+*/
+
+static NMEA0183_FIELD_STATUS scan_decimal( const char *field, int length, bool& negative,
+                                           unsigned long long& mantissa, int& fraction_digits )
+{
+   int index = 0;
+
+   negative        = false;
+   mantissa        = 0;
+   fraction_digits = 0;
+
+   while( index < length && field[ index ] == ' ' )
+   {
+      index++;
+   }
+
+   while( length > index && field[ length - 1 ] == ' ' )
+   {
+      length--;
+   }
+
+   if ( index == length )
+   {
+      return( FieldEmpty );
+   }
+
+   if ( field[ index ] == '-' || field[ index ] == '+' )
+   {
+      negative = field[ index ] == '-';
+      index++;
+   }
+
+   bool seen_point  = false;
+   int  digits      = 0;
+   int  significant = 0;
+
+   for( ; index < length; index++ )
+   {
+      char character = field[ index ];
+
+      if ( character >= '0' && character <= '9' )
+      {
+         digits++;
+
+         if ( significant < 19 )
+         {
+            if ( mantissa != 0 || character != '0' )
+            {
+               significant++;
+            }
+
+            mantissa = mantissa * 10 + ( character - '0' );
+
+            if ( seen_point )
+            {
+               fraction_digits++;
+            }
+         }
+         else if ( ! seen_point )
+         {
+            /*
+            ** Too many digits to hold, remember the magnitude only
+            */
+
+            fraction_digits--;
+         }
+      }
+      else if ( character == '.' && ! seen_point )
+      {
+         seen_point = true;
+      }
+      else
+      {
+         return( FieldInvalid );
+      }
+   }
+
+   if ( digits == 0 )
+   {
+      return( FieldInvalid );
+   }
+
+   return( FieldValid );
+}
+
+NMEA0183_FIELD_STATUS decode_double( const char *field, int length, double& value )
+{
+   bool negative = false;
+   unsigned long long mantissa = 0;
+   int fraction_digits = 0;
+
+   NMEA0183_FIELD_STATUS status = scan_decimal( field, length, negative, mantissa, fraction_digits );
+
+   if ( status != FieldValid )
+   {
+      value = 0.0;
+      return( status );
+   }
+
+   /*
+   ** NMEA never carries more than about 10 significant digits, so the
+   ** mantissa fits in 53 bits and one division by an exact power of ten
+   ** gives the correctly rounded result.  Anything longer is still
+   ** decoded, to within an ulp or so.
+   */
+
+   double result = (double) mantissa;
+
+   if ( fraction_digits > 0 )
+   {
+      if ( fraction_digits <= MAXIMUM_EXACT_POWER_OF_TEN && mantissa <= MAXIMUM_EXACT_MANTISSA )
+      {
+         result /= exact_powers_of_ten[ fraction_digits ];
+      }
+      else
+      {
+         result /= ::pow( 10.0, fraction_digits );
+      }
+   }
+   else if ( fraction_digits < 0 )
+   {
+      result *= ::pow( 10.0, -fraction_digits );
+   }
+
+   value = negative ? -result : result;
+
+   return( FieldValid );
+}
+
+NMEA0183_FIELD_STATUS decode_integer( const char *field, int length, int& value )
+{
+   bool negative = false;
+   unsigned long long mantissa = 0;
+   int fraction_digits = 0;
+
+   NMEA0183_FIELD_STATUS status = scan_decimal( field, length, negative, mantissa, fraction_digits );
+
+   value = 0;
+
+   if ( status != FieldValid )
+   {
+      return( status );
+   }
+
+   /*
+   ** Like atoi() any fraction is dropped, "08.0" is 8
+   */
+
+   while( fraction_digits > 0 )
+   {
+      mantissa /= 10;
+      fraction_digits--;
+   }
+
+   if ( fraction_digits < 0 || mantissa > 0x7FFFFFFFULL )
+   {
+      return( FieldInvalid );
+   }
+
+   value = negative ? -(int) mantissa : (int) mantissa;
+
+   return( FieldValid );
+}
+
+NMEA0183_FIELD_STATUS decode_coordinate( const char *field, int length, int maximum_degrees, int& degrees_e7 )
+{
+   bool negative = false;
+   unsigned long long mantissa = 0;
+   int fraction_digits = 0;
+
+   NMEA0183_FIELD_STATUS status = scan_decimal( field, length, negative, mantissa, fraction_digits );
+
+   degrees_e7 = 0;
+
+   if ( status != FieldValid )
+   {
+      return( status );
+   }
+
+   if ( negative || fraction_digits < 0 )
+   {
+      return( FieldInvalid );
+   }
+
+   /*
+   ** (d)ddmm.mmmm, bring the minutes fraction to exactly 7 digits
+   */
+
+   while( fraction_digits > 7 )
+   {
+      mantissa /= 10;
+      fraction_digits--;
+   }
+
+   unsigned long long scale = 1;
+
+   while( fraction_digits < 7 )
+   {
+      scale *= 10;
+      fraction_digits++;
+   }
+
+   /*
+   ** Up to 19 digits were kept, far more than (d)ddmm needs.  Refuse what
+   ** would wrap rather than range check whatever it wrapped to.
+   */
+
+   if ( mantissa > ULLONG_MAX / scale )
+   {
+      return( FieldInvalid );
+   }
+
+   mantissa *= scale;
+
+   unsigned long long minutes_e7 = mantissa % 1000000000ULL; // mm.mmmmmmm
+   unsigned long long degrees    = mantissa / 1000000000ULL;
+
+   if ( minutes_e7 >= 600000000ULL || degrees > (unsigned long long) maximum_degrees )
+   {
+      return( FieldInvalid );
+   }
+
+   unsigned long long position_e7 = degrees * 10000000ULL + ( minutes_e7 + 30 ) / 60;
+
+   /*
+   ** 90 for a latitude, 180 for a longitude, 9030.000 is as bad as 9100.000
+   */
+
+   if ( position_e7 > (unsigned long long) maximum_degrees * 10000000ULL )
+   {
+      return( FieldInvalid );
+   }
+
+   degrees_e7 = (int) position_e7;
+
+   return( FieldValid );
+}
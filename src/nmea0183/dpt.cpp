@@ -41,9 +41,18 @@
 
 //IMPLEMENT_DYNAMIC( DPT, RESPONSE )
 
+/*
+** Fields in sentence order
+*/
+
+typedef NMEA0183_SCHEMA<
+   NMEA0183_FIELD( DPT, DepthMeters, 1 ),
+   NMEA0183_FIELD( DPT, OffsetFromTransducerMeters, 2 ) > DPT_SCHEMA;
+
 DPT::DPT()
 {
    Mnemonic = _T("DPT");
+   SentenceID = SID_DPT;
    Empty();
 }
 
@@ -57,8 +66,7 @@ void DPT::Empty( void )
 {
 //   ASSERT_VALID( this );
 
-   DepthMeters                = 0.0;
-   OffsetFromTransducerMeters = 0.0;
+   DPT_SCHEMA::Empty( *this );
 }
 
 bool DPT::Parse( const SENTENCE& sentence )
@@ -84,14 +92,13 @@ bool DPT::Parse( const SENTENCE& sentence )
    ** First we check the checksum...
    */
 
-   if ( sentence.IsChecksumBad( 3 ) == TRUE )
+   if ( sentence.IsChecksumBad( DPT_SCHEMA::End ) == TRUE )
    {
       SetErrorMessage( _T("Invalid Checksum") );
       return( FALSE );
    } 
 
-   DepthMeters                = sentence.Double( 1 );
-   OffsetFromTransducerMeters = sentence.Double( 2 );
+   DPT_SCHEMA::Parse( sentence, *this );
 
    return( TRUE );
 }
@@ -106,20 +113,29 @@ bool DPT::Write( SENTENCE& sentence )
    
    RESPONSE::Write( sentence );
 
-   sentence += DepthMeters;
-   sentence += OffsetFromTransducerMeters;
+   DPT_SCHEMA::Write( sentence, *this );
 
    sentence.Finish();
 
    return( TRUE );
 }
 
+int DPT::Encode( char *buffer, int buffer_size, unsigned short talker_code )
+{
+   ENCODER encoder( buffer, buffer_size );
+
+   RESPONSE::Write( encoder, talker_code );
+
+   DPT_SCHEMA::Write( encoder, *this );
+
+   return( encoder.Finish() );
+}
+
 const DPT& DPT::operator = ( const DPT& source )
 {
 //   ASSERT_VALID( this );
 
-   DepthMeters                = source.DepthMeters;
-   OffsetFromTransducerMeters = source.OffsetFromTransducerMeters;
+   DPT_SCHEMA::Copy( *this, source );
 
    return( *this );
 }
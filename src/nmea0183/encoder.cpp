@@ -0,0 +1,437 @@
+/***************************************************************************
+ *
+ * Project:  OpenCPN
+ * Purpose:  NMEA0183 Support Classes
+ * Author:   Sean D'Epagnier
+ *
+ ***************************************************************************
+ *   Copyright (C) 2018 by Sean D'Epagnier                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.             *
+ ***************************************************************************
+ */
+
+
+
+#include "nmea0183.h"
+
+#include <stdio.h>
+
+/*
+** Room kept at the end of the buffer for "*hh<CR><LF>" and the NUL
+*/
+
+#define ENCODER_TRAILER_LENGTH 6
+
+static const char hex_digits[] = "0123456789ABCDEF";
+
+ENCODER::ENCODER( char *destination, int destination_size )
+{
+   buffer      = destination;
+   buffer_size = ( destination != NULL ) ? destination_size : 0;
+   length      = 0;
+   checksum    = 0;
+   overflow    = ( buffer_size < ENCODER_TRAILER_LENGTH );
+}
+
+ENCODER::~ENCODER()
+{
+   buffer = (char *) NULL;
+}
+
+void ENCODER::put( char character )
+{
+   if ( length >= buffer_size - ENCODER_TRAILER_LENGTH )
+   {
+      overflow = true;
+      return;
+   }
+
+   buffer[ length++ ] = character;
+
+   /*
+   ** Everything between the '$' and the '*'
+   */
+
+   if ( length > 1 )
+   {
+      checksum ^= (unsigned char) character;
+   }
+}
+
+void ENCODER::put_unsigned( unsigned long long value, int minimum_digits )
+{
+   char digits[ 20 ];
+   int number_of_digits = 0;
+
+   do
+   {
+      digits[ number_of_digits++ ] = (char) ( '0' + value % 10 );
+      value /= 10;
+   }
+   while( value != 0 );
+
+   while( number_of_digits < minimum_digits )
+   {
+      put( '0' );
+      minimum_digits--;
+   }
+
+   while( number_of_digits > 0 )
+   {
+      put( digits[ --number_of_digits ] );
+   }
+}
+
+void ENCODER::Begin( unsigned short talker_code, const wxString& mnemonic )
+{
+   length   = 0;
+   checksum = 0;
+   overflow = ( buffer_size < ENCODER_TRAILER_LENGTH );
+
+   put( '$' );
+
+   if ( talker_code != 0 )
+   {
+      put( (char) ( talker_code >> 8 ) );
+      put( (char) ( talker_code & 0xFF ) );
+   }
+   else
+   {
+      put( '-' );
+      put( '-' );
+   }
+
+   Append( mnemonic, 0, (int) mnemonic.Len() );
+}
+
+void ENCODER::Append( const wxString& characters, int first, int last )
+{
+   /*
+   ** Copied as they are, no field separator
+   */
+
+   for( int index = first; index < last; index++ )
+   {
+      wxChar character = characters[ index ];
+      put( ( character > 0 && character < 0x80 ) ? (char) character : '?' );
+   }
+}
+
+void ENCODER::Unit( char unit )
+{
+   put( ',' );
+   put( unit );
+}
+
+int ENCODER::Finish( void )
+{
+   if ( overflow )
+   {
+      if ( buffer_size > 0 )
+      {
+         buffer[ 0 ] = 0x00;
+      }
+
+      return( 0 );
+   }
+
+   /*
+   ** put() always left room for these
+   */
+
+   buffer[ length++ ] = '*';
+   buffer[ length++ ] = hex_digits[ checksum >> 4 ];
+   buffer[ length++ ] = hex_digits[ checksum & 0x0F ];
+   buffer[ length++ ] = CARRIAGE_RETURN;
+   buffer[ length++ ] = LINE_FEED;
+   buffer[ length ]   = 0x00;
+
+   return( length );
+}
+
+int ENCODER::GetLength( void ) const
+{
+   return( length );
+}
+
+bool ENCODER::IsOverflow( void ) const
+{
+   return( overflow );
+}
+
+ENCODER& ENCODER::operator += ( const wxString& value )
+{
+   put( ',' );
+   Append( value, 0, (int) value.Len() );
+
+   return( *this );
+}
+
+ENCODER& ENCODER::operator += ( const char *value )
+{
+   put( ',' );
+
+   while( value != NULL && *value != 0x00 )
+   {
+      put( *value++ );
+   }
+
+   return( *this );
+}
+
+ENCODER& ENCODER::operator += ( double value )
+{
+   put( ',' );
+
+   /*
+   ** NAN is what an empty field parsed to, write it back empty
+   */
+
+   if ( value != value )
+   {
+      return( *this );
+   }
+
+   bool negative = ( value < 0.0 || ( value == 0.0 && 1.0 / value < 0.0 ) );
+   double magnitude = negative ? -value : value;
+
+   if ( magnitude >= 1e12 )
+   {
+      /*
+      ** Too big for exact thousandths in a double, nothing in NMEA gets here
+      */
+
+      char text[ 400 ];
+      ::snprintf( text, sizeof( text ), "%.3f", value );
+
+      for( const char *character = text; *character != 0x00; character++ )
+      {
+         put( *character );
+      }
+
+      return( *this );
+   }
+
+   /*
+   ** Same digits as "%.3f", which rounds the exact binary value and sends
+   ** an exact tie to the even digit.  With magnitude = mantissa * 2^exponent
+   ** the product mantissa * 1000 fits in 63 bits, so thousandths and the
+   ** rounding decision come out of integer arithmetic.
+   */
+
+   int exponent = 0;
+   double fraction = ::frexp( magnitude, &exponent );
+
+   unsigned long long product = (unsigned long long) ::ldexp( fraction, 53 ) * 1000ULL;
+   int shift = 53 - exponent;
+
+   unsigned long long thousandths = 0;
+
+   if ( shift <= 0 )
+   {
+      thousandths = product << -shift;
+   }
+   else if ( shift < 64 )
+   {
+      unsigned long long remainder = product & ( ( 1ULL << shift ) - 1 );
+      unsigned long long half      = 1ULL << ( shift - 1 );
+
+      thousandths = product >> shift;
+
+      if ( remainder > half || ( remainder == half && ( thousandths & 1 ) != 0 ) )
+      {
+         thousandths++;
+      }
+   }
+
+   /*
+   ** else less than half a thousandth, which rounds to 0
+   */
+
+   if ( negative )
+   {
+      put( '-' );
+   }
+
+   put_unsigned( thousandths / 1000, 1 );
+   put( '.' );
+   put_unsigned( thousandths % 1000, 3 );
+
+   return( *this );
+}
+
+ENCODER& ENCODER::operator += ( int value )
+{
+   put( ',' );
+
+   unsigned long long magnitude = (unsigned long long) value;
+
+   if ( value < 0 )
+   {
+      put( '-' );
+      magnitude = (unsigned long long) ( -(long long) value );
+   }
+
+   put_unsigned( magnitude, 1 );
+
+   return( *this );
+}
+
+ENCODER& ENCODER::operator += ( NORTHSOUTH northing )
+{
+   put( ',' );
+
+   if ( northing == North )
+   {
+      put( 'N' );
+   }
+   else if ( northing == South )
+   {
+      put( 'S' );
+   }
+
+   return( *this );
+}
+
+ENCODER& ENCODER::operator += ( EASTWEST easting )
+{
+   put( ',' );
+
+   if ( easting == East )
+   {
+      put( 'E' );
+   }
+   else if ( easting == West )
+   {
+      put( 'W' );
+   }
+
+   return( *this );
+}
+
+ENCODER& ENCODER::operator += ( LEFTRIGHT left_or_right )
+{
+   put( ',' );
+
+   if ( left_or_right == Left )
+   {
+      put( 'L' );
+   }
+   else if ( left_or_right == Right )
+   {
+      put( 'R' );
+   }
+
+   return( *this );
+}
+
+ENCODER& ENCODER::operator += ( NMEA0183_BOOLEAN boolean )
+{
+   put( ',' );
+
+   if ( boolean == NTrue )
+   {
+      put( 'A' );
+   }
+   else if ( boolean == NFalse )
+   {
+      put( 'V' );
+   }
+
+   return( *this );
+}
+
+/*
+** Positions are written the way LATITUDE::Write() and LONGITUDE::Write()
+** do it, from decimal degrees into (d)ddmm.mmm
+*/
+
+static void split_degrees( double degrees, bool& negative, int& whole_degrees, int& thousandths_of_minutes )
+{
+   negative = ( degrees < 0.0 );
+
+   if ( negative )
+   {
+      degrees = -degrees;
+   }
+
+   whole_degrees          = (int) degrees;
+   thousandths_of_minutes = (int) ( ( degrees - (double) whole_degrees ) * 60000.0 );
+
+   /*
+   ** "%d" of -0 has no sign
+   */
+
+   if ( whole_degrees == 0 )
+   {
+      negative = false;
+   }
+}
+
+ENCODER& ENCODER::operator += ( const LATITUDE& latitude )
+{
+   bool negative = false;
+   int degrees = 0;
+   int minutes = 0;
+
+   split_degrees( latitude.Latitude, negative, degrees, minutes );
+
+   put( ',' );
+
+   if ( negative )
+   {
+      put( '-' );
+   }
+
+   put_unsigned( degrees, 1 );
+   put_unsigned( minutes / 1000, 2 );
+   put( '.' );
+   put_unsigned( minutes % 1000, 3 );
+
+   return( *this += latitude.Northing );
+}
+
+ENCODER& ENCODER::operator += ( const LONGITUDE& longitude )
+{
+   bool negative = false;
+   int degrees = 0;
+   int minutes = 0;
+
+   split_degrees( longitude.Longitude, negative, degrees, minutes );
+
+   put( ',' );
+
+   if ( negative )
+   {
+      put( '-' );
+   }
+
+   put_unsigned( degrees, negative ? 2 : 3 );
+   put_unsigned( minutes / 1000, 2 );
+   put( '.' );
+   put_unsigned( minutes % 1000, 3 );
+
+   return( *this += longitude.Easting );
+}
+
+ENCODER& ENCODER::operator += ( const LATLONG& position )
+{
+   *this += position.Latitude;
+   *this += position.Longitude;
+
+   return( *this );
+}
@@ -40,389 +40,128 @@
 ** You can use it any way you like.
 */
 
-wxString& expand_talker_id( const wxString &identifier )
-{
-   static wxString expanded_identifier;
+/*
+** Sorted by code so a lookup is a binary search, the order is checked
+** when compiling
+*/
 
-   char first_character  = 0x00;
-   char second_character = 0x00;
+typedef struct
+{
+   unsigned short Code;
+   const char    *Description;
+} TALKER_DESCRIPTION;
 
-   first_character  = identifier[ 0 ];
-   second_character = identifier[ 1 ];
+static constexpr TALKER_DESCRIPTION talker_descriptions[] =
+{
+   { TALKER_CODE( 'A', 'G' ), "Autopilot - General" },
+   { TALKER_CODE( 'A', 'P' ), "Autopilot - Magnetic" },
+   { TALKER_CODE( 'C', 'C' ), "Commputer - Programmed Calculator (outdated)" },
+   { TALKER_CODE( 'C', 'D' ), "Communications - Digital Selective Calling (DSC)" },
+   { TALKER_CODE( 'C', 'M' ), "Computer - Memory Data (outdated)" },
+   { TALKER_CODE( 'C', 'S' ), "Communications - Satellite" },
+   { TALKER_CODE( 'C', 'T' ), "Communications - Radio-Telephone (MF/HF)" },
+   { TALKER_CODE( 'C', 'V' ), "Communications - Radio-Telephone (VHF)" },
+   { TALKER_CODE( 'C', 'X' ), "Communications - Scanning Receiver" },
+   { TALKER_CODE( 'D', 'E' ), "DECCA Navigation" },
+   { TALKER_CODE( 'D', 'F' ), "Direction Finder" },
+   { TALKER_CODE( 'E', 'C' ), "Electronic Chart Display & Information System (ECDIS)" },
+   { TALKER_CODE( 'E', 'P' ), "Emergency Position Indicating Beacon (EPIRB)" },
+   { TALKER_CODE( 'E', 'R' ), "Engine Room Monitoring Systems" },
+   { TALKER_CODE( 'G', 'P' ), "Global Positioning System (GPS)" },
+   { TALKER_CODE( 'H', 'C' ), "Heading - Magnetic Compass" },
+   { TALKER_CODE( 'H', 'E' ), "Heading - North Seeking Gyro" },
+   { TALKER_CODE( 'H', 'N' ), "Heading - Non North Seeking Gyro" },
+   { TALKER_CODE( 'I', 'I' ), "Integrated Instrumentation" },
+   { TALKER_CODE( 'I', 'N' ), "Integrated Navigation" },
+   { TALKER_CODE( 'L', 'A' ), "Loran A" },
+   { TALKER_CODE( 'L', 'C' ), "Loran C" },
+   { TALKER_CODE( 'M', 'P' ), "Microwave Positioning System (outdated)" },
+   { TALKER_CODE( 'O', 'M' ), "OMEGA Navigation System" },
+   { TALKER_CODE( 'O', 'S' ), "Distress Alarm System (outdated)" },
+   { TALKER_CODE( 'R', 'A' ), "RADAR and/or ARPA" },
+   { TALKER_CODE( 'S', 'D' ), "Sounder, Depth" },
+   { TALKER_CODE( 'S', 'N' ), "Electronic Positioning System, other/general" },
+   { TALKER_CODE( 'S', 'S' ), "Sounder, Scanning" },
+   { TALKER_CODE( 'T', 'I' ), "Turn Rate Indicator" },
+   { TALKER_CODE( 'T', 'R' ), "TRANSIT Navigation System" },
+   { TALKER_CODE( 'V', 'D' ), "Velocity Sensor, Doppler, other/general" },
+   { TALKER_CODE( 'V', 'M' ), "Velocity Sensor, Speed Log, Water, Magnetic" },
+   { TALKER_CODE( 'V', 'W' ), "Velocity Sensor, Speed Log, Water, Mechanical" },
+   { TALKER_CODE( 'W', 'I' ), "Weather Instruments" },
+   { TALKER_CODE( 'Y', 'C' ), "Transducer - Temperature (outdated)" },
+   { TALKER_CODE( 'Y', 'D' ), "Transducer - Displacement, Angular or Linear (outdated)" },
+   { TALKER_CODE( 'Y', 'F' ), "Transducer - Frequency (outdated)" },
+   { TALKER_CODE( 'Y', 'L' ), "Transducer - Level (outdated)" },
+   { TALKER_CODE( 'Y', 'P' ), "Transducer - Pressure (outdated)" },
+   { TALKER_CODE( 'Y', 'R' ), "Transducer - Flow Rate (outdated)" },
+   { TALKER_CODE( 'Y', 'T' ), "Transducer - Tachometer (outdated)" },
+   { TALKER_CODE( 'Y', 'V' ), "Transducer - Volume (outdated)" },
+   { TALKER_CODE( 'Y', 'X' ), "Transducer" },
+   { TALKER_CODE( 'Z', 'A' ), "Timekeeper - Atomic Clock" },
+   { TALKER_CODE( 'Z', 'C' ), "Timekeeper - Chronometer" },
+   { TALKER_CODE( 'Z', 'Q' ), "Timekeeper - Quartz" },
+   { TALKER_CODE( 'Z', 'V' ), "Timekeeper - Radio Update, WWV or WWVH" }
+};
+
+#define NUMBER_OF_TALKER_DESCRIPTIONS ( sizeof( talker_descriptions ) / sizeof( talker_descriptions[ 0 ] ) )
+
+static constexpr bool talker_descriptions_sorted( unsigned int index )
+{
+   return( index + 1 >= NUMBER_OF_TALKER_DESCRIPTIONS ||
+           ( talker_descriptions[ index ].Code < talker_descriptions[ index + 1 ].Code &&
+             talker_descriptions_sorted( index + 1 ) ) );
+}
 
-   /*
-   ** Set up our default return value
-   */
+static_assert( talker_descriptions_sorted( 0 ), "talker_descriptions must be sorted by Code" );
 
-   expanded_identifier = _T("Unknown - ");
-   expanded_identifier += identifier;
+const char *talker_description( unsigned short talker_code )
+{
+   int low  = 0;
+   int high = NUMBER_OF_TALKER_DESCRIPTIONS - 1;
 
-   switch( first_character )
+   while( low <= high )
    {
-      case 'A': // AG, AP
-
-         switch( second_character )
-         {
-            case 'G': // AG
-
-                expanded_identifier = _T("Autopilot - General");
-               break;
-
-            case 'P': // AP
-
-                expanded_identifier = _T("Autopilot - Magnetic");
-               break;
-         }
-
-         break;
-
-      case 'C': // CD, CS, CT, CV, CX and CC,CM
-
-         switch( second_character )
-         {
-            case 'C': // CC
-
-                expanded_identifier = _T("Commputer - Programmed Calculator (outdated)");
-               break;
-
-            case 'D': // CD
-
-                expanded_identifier = _T("Communications - Digital Selective Calling (DSC)");
-               break;
-
-            case 'M': // CM
-
-                expanded_identifier = _T("Computer - Memory Data (outdated)");
-               break;
-
-            case 'S': // CS
-
-                expanded_identifier = _T("Communications - Satellite");
-               break;
-
-            case 'T': // CT
-
-                expanded_identifier = _T("Communications - Radio-Telephone (MF/HF)");
-               break;
-
-            case 'V': // CV
-
-                expanded_identifier = _T("Communications - Radio-Telephone (VHF)");
-               break;
-
-            case 'X': // CX
-
-                expanded_identifier = _T("Communications - Scanning Receiver");
-               break;
-         }
-
-         break;
-
-      case 'D': // DE, DF
-
-         switch( second_character )
-         {
-            case 'E': // DE
-
-                expanded_identifier = _T("DECCA Navigation");
-               break;
-
-            case 'F': // DF
-
-                expanded_identifier = _T("Direction Finder");
-               break;
-         }
-
-         break;
-
-      case 'E': // EC, EP, ER
-
-         switch( second_character )
-         {
-            case 'C': // EC
-
-                expanded_identifier = _T("Electronic Chart Display & Information System (ECDIS)");
-               break;
-
-            case 'P': // EP
-
-                expanded_identifier = _T("Emergency Position Indicating Beacon (EPIRB)");
-               break;
-
-            case 'R': // ER
-
-                expanded_identifier = _T("Engine Room Monitoring Systems");
-               break;
-         }
-
-         break;
-
-      case 'G': // GP
-
-         switch( second_character )
-         {
-            case 'P': // GP
-
-                expanded_identifier = _T("Global Positioning System (GPS)");
-               break;
-         }
-
-         break;
-
-      case 'H': // HC, HE, HN
-
-         switch( second_character )
-         {
-            case 'C': // HC
-
-                expanded_identifier = _T("Heading - Magnetic Compass");
-               break;
-
-            case 'E': // HE
-
-                expanded_identifier = _T("Heading - North Seeking Gyro");
-               break;
-
-            case 'N': // HN
-
-                expanded_identifier = _T("Heading - Non North Seeking Gyro");
-               break;
-         }
-
-         break;
-
-      case 'I': // II, IN
-
-         switch( second_character )
-         {
-            case 'I': // II
-
-                expanded_identifier = _T("Integrated Instrumentation");
-               break;
-
-            case 'N': // IN
-
-                expanded_identifier = _T("Integrated Navigation");
-               break;
-         }
-
-         break;
-
-      case 'L': // LA, LC
-
-         switch( second_character )
-         {
-            case 'A': // LA
-
-                expanded_identifier = _T("Loran A");
-               break;
-
-            case 'C': // LC
-
-                expanded_identifier = _T("Loran C");
-               break;
-         }
-
-         break;
-
-      case 'M': // MP
-
-         switch( second_character )
-         {
-            case 'P': // MP
-
-                expanded_identifier = _T("Microwave Positioning System (outdated)");
-               break;
-         }
-
-         break;
-
-      case 'O': // OM, OS
-
-         switch( second_character )
-         {
-            case 'M': // OM
-
-                expanded_identifier = _T("OMEGA Navigation System");
-               break;
-
-            case 'S': // OS
-
-                expanded_identifier = _T("Distress Alarm System (outdated)");
-               break;
-         }
-
-         break;
-
-      case 'P': // P
-
-         break;
-
-      case 'R': // RA
-
-         switch( second_character )
-         {
-            case 'A': // RA
-
-                expanded_identifier = _T("RADAR and/or ARPA");
-               break;
-         }
-
-         break;
-
-      case 'S': // SD, SN, SS
-
-         switch( second_character )
-         {
-            case 'D': // SD
-
-                expanded_identifier = _T("Sounder, Depth");
-               break;
-
-            case 'N': // SN
-
-                expanded_identifier = _T("Electronic Positioning System, other/general");
-               break;
-
-            case 'S': // SS
-
-                expanded_identifier = _T("Sounder, Scanning");
-               break;
-         }
-
-         break;
-
-      case 'T': // TI, TR
-
-         switch( second_character )
-         {
-            case 'I': // TI
-
-                expanded_identifier = _T("Turn Rate Indicator");
-               break;
-
-            case 'R': // TR
-
-                expanded_identifier = _T("TRANSIT Navigation System");
-               break;
-         }
-
-         break;
-
-      case 'V': // VD, VM, VW
-
-         switch( second_character )
-         {
-            case 'D': // VD
-
-                expanded_identifier = _T("Velocity Sensor, Doppler, other/general");
-               break;
-
-            case 'M': // VM
-
-                expanded_identifier = _T("Velocity Sensor, Speed Log, Water, Magnetic");
-               break;
-
-            case 'W': // VW
-
-                expanded_identifier = _T("Velocity Sensor, Speed Log, Water, Mechanical");
-               break;
-         }
-
-         break;
-
-
-      case 'W': // WI
-
-         switch( second_character )
-         {
-            case 'I': // WI
-
-                expanded_identifier = _T("Weather Instruments");
-               break;
-         }
-
-         break;
-
-      case 'Y': // YC, YD, YF, YL, YP, YR, YT, YV, YX
-
-         switch( second_character )
-         {
-            case 'C': // YC
-
-                expanded_identifier = _T("Transducer - Temperature (outdated)");
-               break;
-
-            case 'D': // YD
-
-                expanded_identifier = _T("Transducer - Displacement, Angular or Linear (outdated)");
-               break;
-
-            case 'F': // YF
-
-                expanded_identifier = _T("Transducer - Frequency (outdated)");
-               break;
-
-            case 'L': // YL
-
-                expanded_identifier = _T("Transducer - Level (outdated)");
-               break;
-
-            case 'P': // YP
-
-                expanded_identifier = _T("Transducer - Pressure (outdated)");
-               break;
-
-            case 'R': // YR
-
-                expanded_identifier = _T("Transducer - Flow Rate (outdated)");
-               break;
-
-            case 'T': // YT
-
-                expanded_identifier = _T("Transducer - Tachometer (outdated)");
-               break;
-
-            case 'V': // YV
-
-                expanded_identifier = _T("Transducer - Volume (outdated)");
-               break;
-
-            case 'X': // YX
-
-                expanded_identifier = _T("Transducer");
-               break;
-
-         }
-
-         break;
-
-      case 'Z': // ZA, ZC, ZQ, ZV
-
-         switch( second_character )
-         {
-            case 'A': // ZA
-
-                expanded_identifier = _T("Timekeeper - Atomic Clock");
-               break;
-
-            case 'C': // ZC
+      int middle = ( low + high ) / 2;
+
+      if ( talker_descriptions[ middle ].Code == talker_code )
+      {
+         return( talker_descriptions[ middle ].Description );
+      }
+
+      if ( talker_descriptions[ middle ].Code < talker_code )
+      {
+         low = middle + 1;
+      }
+      else
+      {
+         high = middle - 1;
+      }
+   }
 
-                expanded_identifier = _T("Timekeeper - Chronometer");
-               break;
+   return( (const char *) NULL );
+}
 
-            case 'Q': // ZQ
+wxString expand_talker_id( const wxString &identifier )
+{
+   wxString expanded_identifier;
 
-                expanded_identifier = _T("Timekeeper - Quartz");
-               break;
+   unsigned short talker_code = 0;
 
-            case 'V': // ZV
+   if ( identifier.Len() >= 2 )
+   {
+      talker_code = TALKER_CODE( (wxChar) identifier[ 0 ], (wxChar) identifier[ 1 ] );
+   }
 
-                expanded_identifier = _T("Timekeeper - Radio Update, WWV or WWVH");
-               break;
-         }
+   const char *description = talker_description( talker_code );
 
-         break;
+   if ( description != NULL )
+   {
+      expanded_identifier = wxString::FromAscii( description );
+   }
+   else
+   {
+      expanded_identifier = _T("Unknown - ");
+      expanded_identifier += identifier;
    }
 
    return( expanded_identifier );
@@ -0,0 +1,214 @@
+/***************************************************************************
+ *
+ * Project:  OpenCPN
+ * Purpose:  NMEA0183 Support Classes
+ * Author:   Sean D'Epagnier
+ *
+ ***************************************************************************
+ *   Copyright (C) 2018 by Sean D'Epagnier                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.             *
+ ***************************************************************************
+ */
+
+
+
+#include "nmea0183.h"
+
+FRAMER::FRAMER()
+{
+   Reset();
+}
+
+FRAMER::~FRAMER()
+{
+   Reset();
+}
+
+void FRAMER::Reset( void )
+{
+   chunk           = (const char *) NULL;
+   chunk_length    = 0;
+   position        = 0;
+   in_sentence     = false;
+   sentence_start  = -1;
+   carry[ 0 ]      = 0x00;
+   carry_length    = 0;
+   Sentences       = 0;
+   DiscardedBytes  = 0;
+   Overruns        = 0;
+   tag_block_state = TagBlockNone;
+}
+
+void FRAMER::Write( const char *data, int length )
+{
+   /*
+   ** Anything left of the previous chunk has already been carried over
+   ** by the Next() call that returned false
+   */
+
+   chunk          = data;
+   chunk_length   = ( data != NULL && length > 0 ) ? length : 0;
+   position       = 0;
+   sentence_start = -1;
+}
+
+int FRAMER::current_length( void ) const
+{
+   if ( sentence_start >= 0 )
+   {
+      return( position - sentence_start );
+   }
+
+   return( carry_length + position );
+}
+
+void FRAMER::overrun( void )
+{
+   /*
+   ** Far too long to be NMEA, wait for the next start character
+   */
+
+   DiscardedBytes += current_length();
+   Overruns++;
+
+   in_sentence     = false;
+   sentence_start  = -1;
+   carry_length    = 0;
+   tag_block_state = TagBlockNone;
+}
+
+bool FRAMER::Next( const char *& sentence, int& length )
+{
+   while( position < chunk_length )
+   {
+      char character = chunk[ position ];
+
+      /*
+      ** A tag block (\s:src,c:1577836800*hh\) is kept in front of the
+      ** sentence that follows it
+      */
+
+      bool continues_tag_block = ( in_sentence && tag_block_state == TagBlockClosed && ( character == '$' || character == '!' ) );
+
+      if ( tag_block_state == TagBlockClosed )
+      {
+         tag_block_state = TagBlockNone;
+      }
+
+      if ( in_sentence && tag_block_state == TagBlockOpen && character == '\\' )
+      {
+         tag_block_state = TagBlockClosed;
+      }
+      else if ( ! continues_tag_block && ( character == '$' || character == '!' || character == '\\' ) )
+      {
+         if ( in_sentence )
+         {
+            DiscardedBytes += current_length();
+         }
+
+         in_sentence     = true;
+         sentence_start  = position;
+         carry_length    = 0;
+         tag_block_state = ( character == '\\' ) ? TagBlockOpen : TagBlockNone;
+      }
+      else if ( character == CARRIAGE_RETURN || character == LINE_FEED )
+      {
+         if ( in_sentence )
+         {
+            in_sentence     = false;
+            tag_block_state = TagBlockNone;
+
+            if ( sentence_start >= 0 )
+            {
+               sentence = chunk + sentence_start;
+               length   = position - sentence_start;
+            }
+            else
+            {
+               /*
+               ** Finish the piece carried over from the last chunk, the
+               ** length was checked as the bytes went by
+               */
+
+               ::memcpy( carry + carry_length, chunk, position );
+               carry_length += position;
+               carry[ carry_length ] = 0x00;
+
+               sentence = carry;
+               length   = carry_length;
+            }
+
+            position++;
+            Sentences++;
+
+            return( true );
+         }
+      }
+      else if ( ! in_sentence )
+      {
+         DiscardedBytes++;
+      }
+
+      if ( in_sentence && current_length() >= NMEA0183_MAX_SENTENCE_LENGTH )
+      {
+         overrun();
+         DiscardedBytes++;
+      }
+
+      position++;
+   }
+
+   /*
+   ** Out of bytes, keep the unfinished sentence for the next chunk
+   */
+
+   if ( in_sentence )
+   {
+      if ( sentence_start >= 0 )
+      {
+         carry_length = chunk_length - sentence_start;
+         ::memcpy( carry, chunk + sentence_start, carry_length );
+      }
+      else
+      {
+         ::memcpy( carry + carry_length, chunk, chunk_length );
+         carry_length += chunk_length;
+      }
+   }
+
+   chunk          = (const char *) NULL;
+   chunk_length   = 0;
+   position       = 0;
+   sentence_start = -1;
+
+   return( false );
+}
+
+bool FRAMER::Next( NMEA0183& nmea )
+{
+   const char *sentence = (const char *) NULL;
+   int length = 0;
+
+   if ( ! Next( sentence, length ) )
+   {
+      return( false );
+   }
+
+   nmea.Assign( sentence, length );
+
+   return( true );
+}
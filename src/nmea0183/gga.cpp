@@ -43,9 +43,27 @@
 
 //IMPLEMENT_DYNAMIC( GGA, RESPONSE )
 
+/*
+** Fields in sentence order
+*/
+
+typedef NMEA0183_SCHEMA<
+   NMEA0183_FIELD( GGA, UTCTime, 1 ),
+   NMEA0183_FIELD( GGA, Position, 2 ),
+   NMEA0183_FIELD( GGA, GPSQuality, 6 ),
+   NMEA0183_FIELD( GGA, NumberOfSatellitesInUse, 7 ),
+   NMEA0183_FIELD( GGA, HorizontalDilutionOfPrecision, 8 ),
+   NMEA0183_FIELD( GGA, AntennaAltitudeMeters, 9 ),
+   NMEA0183_UNIT( 10, 'M' ),
+   NMEA0183_FIELD( GGA, GeoidalSeparationMeters, 11 ),
+   NMEA0183_UNIT( 12, 'M' ),
+   NMEA0183_FIELD( GGA, AgeOfDifferentialGPSDataSeconds, 13 ),
+   NMEA0183_FIELD( GGA, DifferentialReferenceStationID, 14 ) > GGA_SCHEMA;
+
 GGA::GGA()
 {
    Mnemonic = _T("GGA");
+   SentenceID = SID_GGA;
    Empty();
 }
 
@@ -59,15 +77,7 @@ void GGA::Empty( void )
 {
 //   ASSERT_VALID( this );
 
-   UTCTime.Empty();
-   Position.Empty();
-   GPSQuality                      = 0;
-   NumberOfSatellitesInUse         = 0;
-   HorizontalDilutionOfPrecision   = 0.0;
-   AntennaAltitudeMeters           = 0.0;
-   GeoidalSeparationMeters         = 0.0;
-   AgeOfDifferentialGPSDataSeconds = 0.0;
-   DifferentialReferenceStationID  = 0;
+   GGA_SCHEMA::Empty( *this );
 }
 
 bool GGA::Parse( const SENTENCE& sentence )
@@ -111,21 +121,13 @@ bool GGA::Parse( const SENTENCE& sentence )
    ** First we check the checksum...
    */
 
-   if ( sentence.IsChecksumBad( 15 ) ==NTrue )
+   if ( sentence.IsChecksumBad( GGA_SCHEMA::End ) ==NTrue )
    {
       SetErrorMessage( _T("Invalid Checksum" ));
       return( FALSE );
    }
 
-   UTCTime                         = sentence.Field( 1 );
-   Position.Parse( 2, 3, 4, 5, sentence );
-   GPSQuality                      = sentence.Integer( 6 );
-   NumberOfSatellitesInUse         = sentence.Integer( 7 );
-   HorizontalDilutionOfPrecision   = sentence.Double( 8 );
-   AntennaAltitudeMeters           = sentence.Double( 9 );
-   GeoidalSeparationMeters         = sentence.Double( 11 );
-   AgeOfDifferentialGPSDataSeconds = sentence.Double( 13 );
-   DifferentialReferenceStationID  = sentence.Integer( 14 );
+   GGA_SCHEMA::Parse( sentence, *this );
 
    return( TRUE );
 }
@@ -140,36 +142,29 @@ bool GGA::Write( SENTENCE& sentence )
 
    RESPONSE::Write( sentence );
 
-   sentence += UTCTime;
-   sentence += Position;
-   sentence += GPSQuality;
-   sentence += NumberOfSatellitesInUse;
-   sentence += HorizontalDilutionOfPrecision;
-   sentence += AntennaAltitudeMeters;
-   sentence += _T("M");
-   sentence += GeoidalSeparationMeters;
-   sentence += _T("M");
-   sentence += AgeOfDifferentialGPSDataSeconds;
-   sentence += DifferentialReferenceStationID;
+   GGA_SCHEMA::Write( sentence, *this );
 
    sentence.Finish();
 
    return( TRUE );
 }
 
+int GGA::Encode( char *buffer, int buffer_size, unsigned short talker_code )
+{
+   ENCODER encoder( buffer, buffer_size );
+
+   RESPONSE::Write( encoder, talker_code );
+
+   GGA_SCHEMA::Write( encoder, *this );
+
+   return( encoder.Finish() );
+}
+
 const GGA& GGA::operator = ( const GGA& source )
 {
 //   ASSERT_VALID( this );
 
-   UTCTime                         = source.UTCTime;
-   Position                        = source.Position;
-   GPSQuality                      = source.GPSQuality;
-   NumberOfSatellitesInUse         = source.NumberOfSatellitesInUse;
-   HorizontalDilutionOfPrecision   = source.HorizontalDilutionOfPrecision;
-   AntennaAltitudeMeters           = source.AntennaAltitudeMeters;
-   GeoidalSeparationMeters         = source.GeoidalSeparationMeters;
-   AgeOfDifferentialGPSDataSeconds = source.AgeOfDifferentialGPSDataSeconds;
-   DifferentialReferenceStationID  = source.DifferentialReferenceStationID;
+   GGA_SCHEMA::Copy( *this, source );
 
    return( *this );
 }
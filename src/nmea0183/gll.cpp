@@ -43,9 +43,19 @@
 
 //IMPLEMENT_DYNAMIC( GLL, RESPONSE )
 
+/*
+** Fields in sentence order
+*/
+
+typedef NMEA0183_SCHEMA<
+   NMEA0183_FIELD( GLL, Position, 1 ),
+   NMEA0183_FIELD( GLL, UTCTime, 5 ),
+   NMEA0183_FIELD( GLL, IsDataValid, 6 ) > GLL_SCHEMA;
+
 GLL::GLL()
 {
    Mnemonic = _T("GLL");
+   SentenceID = SID_GLL;
    Empty();
 }
 
@@ -59,9 +69,7 @@ void GLL::Empty( void )
 {
 //   ASSERT_VALID( this );
 
-   Position.Empty();
-   UTCTime.Empty();
-   IsDataValid = Unknown0183;
+   GLL_SCHEMA::Empty( *this );
 }
 
 bool GLL::Parse( const SENTENCE& sentence )
@@ -86,47 +94,27 @@ bool GLL::Parse( const SENTENCE& sentence )
    ** First we check the checksum...
    */
 
-      int target_field_count = 6;
-
-      NMEA0183_BOOLEAN check = sentence.IsChecksumBad( 7 );
-
-      if ( check == NTrue )
+      if ( sentence.IsChecksumBad( GLL_SCHEMA::End ) == NTrue )
       {
-
-  /*
-            ** This may be an NMEA Version 2.3 sentence, with "Mode" field
-  */
-            wxString checksum_in_sentence = sentence.Field( 7 );
-            if(checksum_in_sentence.StartsWith(_T("*")))       // Field is a valid erroneous checksum
-            {
-                  SetErrorMessage( _T("Invalid Checksum") );
-                  return( FALSE );
-            }
-
-            else
-            {
-                  target_field_count = 7;
-                  check = sentence.IsChecksumBad( 8 );
-                  if( check == NTrue)
-                  {
-                        SetErrorMessage( _T("Invalid Checksum") );
-                        return( FALSE );
-                  }
-            }
+            SetErrorMessage( _T("Invalid Checksum") );
+            return( FALSE );
       }
 
+      /*
+      ** NMEA Version 2.3 sentences append a "Mode" field
+      */
+
+      int number_of_data_fields = sentence.GetNumberOfDataFields();
 
-      if ( sentence.GetNumberOfDataFields() == target_field_count )
+      if ( number_of_data_fields == 6 || number_of_data_fields == 7 )
       {
-            Position.Parse( 1, 2, 3, 4, sentence );
-            UTCTime     = sentence.Field( 5 );
-            IsDataValid = sentence.Boolean( 6 );
+            GLL_SCHEMA::Parse( sentence, *this );
 
             return( TRUE );
       }
 
       //    May be old style GLL sentence
-      if ( sentence.GetNumberOfDataFields() == 4 )
+      if ( number_of_data_fields == 4 )
       {
             Position.Parse( 1, 2, 3, 4, sentence );
             IsDataValid = NTrue;
@@ -140,13 +128,12 @@ bool GLL::Parse( const SENTENCE& sentence )
 }
 
 
-const wxString& GLL::PlainEnglish( void )
+wxString GLL::PlainEnglish( void )
 {
 //   ASSERT_VALID( this );
 
-   static wxString return_string;
+   wxString return_string;
 
-   return_string.Empty();
 /*
    char temp_string[ 128 ];
 
@@ -173,22 +160,29 @@ bool GLL::Write( SENTENCE& sentence )
 
    RESPONSE::Write( sentence );
 
-   sentence += Position;
-   sentence += UTCTime;
-   sentence += IsDataValid;
+   GLL_SCHEMA::Write( sentence, *this );
 
    sentence.Finish();
 
    return( TRUE );
 }
 
+int GLL::Encode( char *buffer, int buffer_size, unsigned short talker_code )
+{
+   ENCODER encoder( buffer, buffer_size );
+
+   RESPONSE::Write( encoder, talker_code );
+
+   GLL_SCHEMA::Write( encoder, *this );
+
+   return( encoder.Finish() );
+}
+
 const GLL& GLL::operator = ( const GLL& source )
 {
 //   ASSERT_VALID( this );
 
-   Position    = source.Position;
-   UTCTime     = source.UTCTime;
-   IsDataValid = source.IsDataValid;
+   GLL_SCHEMA::Copy( *this, source );
 
    return( *this );
 }
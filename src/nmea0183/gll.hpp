@@ -63,8 +63,9 @@ class GLL : public RESPONSE
 
       virtual void Empty( void );
       virtual bool Parse( const SENTENCE& sentence );
-      virtual const wxString& PlainEnglish( void );
+      virtual wxString PlainEnglish( void );
       virtual bool Write( SENTENCE& sentence );
+      virtual int Encode( char *buffer, int buffer_size, unsigned short talker_code );
 
       /*
       ** Operators
@@ -44,6 +44,7 @@
 GSV::GSV()
 {
    Mnemonic = _T("GSV");
+   SentenceID = SID_GSV;
    Empty();
 }
 
@@ -103,6 +104,7 @@ Where:
    **  6) Azimuth, degrees
    **  7) SNR - higher is better
    **  Fields 4-7 may repeat up to 4 times per sentence
+   **  NMEA 4.10 adds a signal ID field after the last satellite
    **  n) Checksum
    */
 
@@ -115,25 +117,30 @@ Where:
    switch (sentence.GetNumberOfDataFields())
    {
    case 19:
-         cksumFieldNr = 20;
+   case 20:
          satInfoCnt = 4;
          break;
    case 15:
-         cksumFieldNr = 16;
+   case 16:
          satInfoCnt = 3;
          break;
    case 11:
-         cksumFieldNr = 12;
+   case 12:
          satInfoCnt = 2;
          break;
    case 7:
-         cksumFieldNr = 8;
+   case 8:
          satInfoCnt = 1;
          break;
+   case 3:
+   case 4:
+         satInfoCnt = 0; // Nothing in view
+         break;
    default:
       SetErrorMessage( _T("Invalid Field count" ));
       return( FALSE );
    }
+   cksumFieldNr = sentence.GetNumberOfDataFields() + 1;
    if ( sentence.IsChecksumBad( cksumFieldNr ) == NTrue )
    {
       SetErrorMessage( _T("Invalid Checksum" ));
@@ -152,6 +159,18 @@ Where:
          SatInfo[idx].SignalToNoiseRatio = sentence.Integer( idx*4+7 );
    }
 
+   /*
+   ** Don't leave the previous message's satellites behind
+   */
+
+   for (int idx = satInfoCnt; idx < 4; idx++)
+   {
+         SatInfo[idx].SatNumber = 0;
+         SatInfo[idx].ElevationDegrees = 0;
+         SatInfo[idx].AzimuthDegreesTrue = 0;
+         SatInfo[idx].SignalToNoiseRatio = 0;
+   }
+
    return( TRUE );
 }
 
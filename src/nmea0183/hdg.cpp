@@ -40,9 +40,21 @@
 ** You can use it any way you like.
 */
 
+/*
+** Fields in sentence order
+*/
+
+typedef NMEA0183_SCHEMA<
+   NMEA0183_FIELD( HDG, MagneticSensorHeadingDegrees, 1 ),
+   NMEA0183_FIELD( HDG, MagneticDeviationDegrees, 2 ),
+   NMEA0183_FIELD( HDG, MagneticDeviationDirection, 3 ),
+   NMEA0183_FIELD( HDG, MagneticVariationDegrees, 4 ),
+   NMEA0183_FIELD( HDG, MagneticVariationDirection, 5 ) > HDG_SCHEMA;
+
 HDG::HDG()
 {
    Mnemonic = _T("HDG");
+   SentenceID = SID_HDG;
    Empty();
 }
 
@@ -54,11 +66,7 @@ HDG::~HDG()
 
 void HDG::Empty( void )
 {
-   MagneticSensorHeadingDegrees = 0.0;
-   MagneticDeviationDegrees     = 0.0;
-   MagneticDeviationDirection   = EW_Unknown;
-   MagneticVariationDegrees     = 0.0;
-   MagneticVariationDirection   = EW_Unknown;
+   HDG_SCHEMA::Empty( *this );
 }
 
 bool HDG::Parse( const SENTENCE& sentence )
@@ -83,17 +91,13 @@ bool HDG::Parse( const SENTENCE& sentence )
    ** First we check the checksum...
    */
 
-   if ( sentence.IsChecksumBad( 6 ) == TRUE )
+   if ( sentence.IsChecksumBad( HDG_SCHEMA::End ) == TRUE )
    {
       SetErrorMessage( _T("Invalid Checksum") );
       return( FALSE );
    }
 
-   MagneticSensorHeadingDegrees = sentence.Double( 1 );
-   MagneticDeviationDegrees     = sentence.Double( 2 );
-   MagneticDeviationDirection   = sentence.EastOrWest( 3 );
-   MagneticVariationDegrees     = sentence.Double( 4 );
-   MagneticVariationDirection   = sentence.EastOrWest( 5 );
+   HDG_SCHEMA::Parse( sentence, *this );
 
    return( TRUE );
 }
@@ -106,24 +110,27 @@ bool HDG::Write( SENTENCE& sentence )
 
    RESPONSE::Write( sentence );
 
-   sentence += MagneticSensorHeadingDegrees;
-   sentence += MagneticDeviationDegrees;
-   sentence += MagneticDeviationDirection;
-   sentence += MagneticVariationDegrees;
-   sentence += MagneticVariationDirection;
+   HDG_SCHEMA::Write( sentence, *this );
 
    sentence.Finish();
 
    return( TRUE );
 }
 
+int HDG::Encode( char *buffer, int buffer_size, unsigned short talker_code )
+{
+   ENCODER encoder( buffer, buffer_size );
+
+   RESPONSE::Write( encoder, talker_code );
+
+   HDG_SCHEMA::Write( encoder, *this );
+
+   return( encoder.Finish() );
+}
+
 const HDG& HDG::operator = ( const HDG& source )
 {
-   MagneticSensorHeadingDegrees = source.MagneticSensorHeadingDegrees;
-   MagneticDeviationDegrees     = source.MagneticDeviationDegrees;
-   MagneticDeviationDirection   = source.MagneticDeviationDirection;
-   MagneticVariationDegrees     = source.MagneticVariationDegrees;
-   MagneticVariationDirection   = source.MagneticVariationDirection;
+   HDG_SCHEMA::Copy( *this, source );
 
    return( *this );
 }
@@ -41,9 +41,18 @@
 */
 
 
+/*
+** Fields in sentence order
+*/
+
+typedef NMEA0183_SCHEMA<
+   NMEA0183_FIELD( HDM, DegreesMagnetic, 1 ),
+   NMEA0183_UNIT( 2, 'M' ) > HDM_SCHEMA;
+
 HDM::HDM()
 {
    Mnemonic = _T("HDM");
+   SentenceID = SID_HDM;
    Empty();
 }
 
@@ -55,7 +64,7 @@ HDM::~HDM()
 
 void HDM::Empty( void )
 {
-   DegreesMagnetic = 0.0;
+   HDM_SCHEMA::Empty( *this );
 }
 
 bool HDM::Parse( const SENTENCE& sentence )
@@ -78,13 +87,13 @@ bool HDM::Parse( const SENTENCE& sentence )
    ** First we check the checksum...
    */
 
-   if ( sentence.IsChecksumBad( 3 ) == TRUE )
+   if ( sentence.IsChecksumBad( HDM_SCHEMA::End ) == TRUE )
    {
       SetErrorMessage( _T("Invalid Checksum") );
       return( FALSE );
    }
 
-   DegreesMagnetic = sentence.Double( 1 );
+   HDM_SCHEMA::Parse( sentence, *this );
 
    return( TRUE );
 }
@@ -97,17 +106,27 @@ bool HDM::Write( SENTENCE& sentence )
 
    RESPONSE::Write( sentence );
 
-   sentence += DegreesMagnetic;
-   sentence += _T("M");
+   HDM_SCHEMA::Write( sentence, *this );
 
    sentence.Finish();
 
    return( TRUE );
 }
 
+int HDM::Encode( char *buffer, int buffer_size, unsigned short talker_code )
+{
+   ENCODER encoder( buffer, buffer_size );
+
+   RESPONSE::Write( encoder, talker_code );
+
+   HDM_SCHEMA::Write( encoder, *this );
+
+   return( encoder.Finish() );
+}
+
 const HDM& HDM::operator = ( const HDM& source )
 {
-      DegreesMagnetic = source.DegreesMagnetic;
+   HDM_SCHEMA::Copy( *this, source );
 
    return( *this );
 }
@@ -41,9 +41,18 @@
 */
 
 
+/*
+** Fields in sentence order
+*/
+
+typedef NMEA0183_SCHEMA<
+   NMEA0183_FIELD( HDT, DegreesTrue, 1 ),
+   NMEA0183_UNIT( 2, 'T' ) > HDT_SCHEMA;
+
 HDT::HDT()
 {
    Mnemonic = _T("HDT");
+   SentenceID = SID_HDT;
    Empty();
 }
 
@@ -55,7 +64,7 @@ HDT::~HDT()
 
 void HDT::Empty( void )
 {
-   DegreesTrue = 0.0;
+   HDT_SCHEMA::Empty( *this );
 }
 
 bool HDT::Parse( const SENTENCE& sentence )
@@ -78,13 +87,13 @@ bool HDT::Parse( const SENTENCE& sentence )
    ** First we check the checksum...
    */
 
-   if ( sentence.IsChecksumBad( 3 ) == TRUE )
+   if ( sentence.IsChecksumBad( HDT_SCHEMA::End ) == TRUE )
    {
       SetErrorMessage( _T("Invalid Checksum") );
       return( FALSE );
    }
 
-   DegreesTrue = sentence.Double( 1 );
+   HDT_SCHEMA::Parse( sentence, *this );
 
    return( TRUE );
 }
@@ -97,17 +106,27 @@ bool HDT::Write( SENTENCE& sentence )
 
    RESPONSE::Write( sentence );
 
-   sentence += DegreesTrue;
-   sentence += _T("T");
+   HDT_SCHEMA::Write( sentence, *this );
 
    sentence.Finish();
 
    return( TRUE );
 }
 
+int HDT::Encode( char *buffer, int buffer_size, unsigned short talker_code )
+{
+   ENCODER encoder( buffer, buffer_size );
+
+   RESPONSE::Write( encoder, talker_code );
+
+   HDT_SCHEMA::Write( encoder, *this );
+
+   return( encoder.Finish() );
+}
+
 const HDT& HDT::operator = ( const HDT& source )
 {
-   DegreesTrue = source.DegreesTrue;
+   HDT_SCHEMA::Copy( *this, source );
 
    return( *this );
 }
@@ -44,14 +44,42 @@ int HexValue( const wxString& hex_string )
 {
    int return_value = 0;
 
-   long scan_value = 0;
+   /*
+   ** Same as sscanf( "%lx" ) without the round trip through UTF-8,
+   ** leading blanks are skipped and the first non hex digit ends it
+   */
 
-   wxCharBuffer abuf = hex_string.ToUTF8();
-   if( !abuf.data() )                            // badly formed sentence?
-        return 0;
+   int string_length = hex_string.Len();
+   int index = 0;
 
-   sscanf( abuf.data(), "%lx",  &scan_value );
+   while( index < string_length && ( hex_string[ index ] == ' ' || hex_string[ index ] == '\t' ) )
+   {
+      index++;
+   }
+
+   while( index < string_length )
+   {
+      wxChar character = hex_string[ index ];
+
+      if ( character >= '0' && character <= '9' )
+      {
+         return_value = ( return_value << 4 ) | ( character - '0' );
+      }
+      else if ( character >= 'A' && character <= 'F' )
+      {
+         return_value = ( return_value << 4 ) | ( character - 'A' + 10 );
+      }
+      else if ( character >= 'a' && character <= 'f' )
+      {
+         return_value = ( return_value << 4 ) | ( character - 'a' + 10 );
+      }
+      else
+      {
+         break;
+      }
+
+      index++;
+   }
 
-   return_value = (int)scan_value;
    return( return_value );
 }
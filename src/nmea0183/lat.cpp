@@ -55,6 +55,7 @@ void LATITUDE::Empty( void )
 {
 
    Latitude = 0.0;
+   DegreesE7 = 0;
    Northing = NS_Unknown;
 }
 
@@ -70,8 +71,26 @@ bool LATITUDE::IsDataValid( void )
 
 void LATITUDE::Parse( int position_field_number, int north_or_south_field_number, const SENTENCE& sentence )
 {
-   wxString n_or_s = sentence.Field( north_or_south_field_number );
-   Set( sentence.Double( position_field_number ), n_or_s );
+   /*
+   ** Decode the position once, straight into fixed point, and keep the
+   ** raw (d)ddmm.mmmm double for existing users
+   */
+
+   Northing = sentence.NorthOrSouth( north_or_south_field_number );
+
+   if ( sentence.Coordinate( position_field_number, 90, DegreesE7 ) != FieldValid )
+   {
+      Latitude = 0.0;
+      DegreesE7 = 0;
+      return;
+   }
+
+   sentence.Double( position_field_number, Latitude );
+
+   if ( Northing == South )
+   {
+      DegreesE7 = -DegreesE7;
+   }
 }
 
 void LATITUDE::Set( double position, const wxString& north_or_south )
@@ -79,6 +98,10 @@ void LATITUDE::Set( double position, const wxString& north_or_south )
 //   assert( north_or_south != NULL );
 
    Latitude = position;
+
+   double degrees = floor( position / 100.0 );
+   DegreesE7 = (int) floor( ( degrees + ( position - degrees * 100.0 ) / 60.0 ) * 10000000.0 + 0.5 );
+
    wxString ts = north_or_south;
 
    if ( ts.Trim(false)[ 0 ] == _T('N') )
@@ -93,6 +116,11 @@ void LATITUDE::Set( double position, const wxString& north_or_south )
    {
       Northing = NS_Unknown;
    }
+
+   if ( Northing == South )
+   {
+      DegreesE7 = -DegreesE7;
+   }
 }
 
 void LATITUDE::Write( SENTENCE& sentence )
@@ -128,8 +156,10 @@ void LATITUDE::Write( SENTENCE& sentence )
    else
    {
       /*
-      ** Add Nothing
+      ** Leave the field empty, dropping it would shift the rest
       */
+
+      sentence += wxString();
    }
 }
 
@@ -137,6 +167,7 @@ const LATITUDE& LATITUDE::operator = ( const LATITUDE& source )
 {
 
    Latitude = source.Latitude;
+   DegreesE7 = source.DegreesE7;
    Northing = source.Northing;
 
    return( *this );
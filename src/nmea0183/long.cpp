@@ -55,6 +55,7 @@ void LONGITUDE::Empty( void )
 {
 
    Longitude = 0.0;
+   DegreesE7 = 0;
    Easting   = EW_Unknown;
 }
 
@@ -70,8 +71,26 @@ bool LONGITUDE::IsDataValid( void )
 
 void LONGITUDE::Parse( int position_field_number, int east_or_west_field_number, const SENTENCE& sentence )
 {
-   wxString w_or_e = sentence.Field( east_or_west_field_number );
-   Set( sentence.Double( position_field_number ), w_or_e );
+   /*
+   ** Decode the position once, straight into fixed point, and keep the
+   ** raw (d)ddmm.mmmm double for existing users
+   */
+
+   Easting = sentence.EastOrWest( east_or_west_field_number );
+
+   if ( sentence.Coordinate( position_field_number, 180, DegreesE7 ) != FieldValid )
+   {
+      Longitude = 0.0;
+      DegreesE7 = 0;
+      return;
+   }
+
+   sentence.Double( position_field_number, Longitude );
+
+   if ( Easting == West )
+   {
+      DegreesE7 = -DegreesE7;
+   }
 }
 
 void LONGITUDE::Set( double position, const wxString& east_or_west )
@@ -79,6 +98,10 @@ void LONGITUDE::Set( double position, const wxString& east_or_west )
 //   assert( east_or_west != NULL );
 
    Longitude = position;
+
+   double degrees = floor( position / 100.0 );
+   DegreesE7 = (int) floor( ( degrees + ( position - degrees * 100.0 ) / 60.0 ) * 10000000.0 + 0.5 );
+
    wxString ts = east_or_west;
 
    if ( ts.Trim(false)[ 0 ] == 'E' )
@@ -93,6 +116,11 @@ void LONGITUDE::Set( double position, const wxString& east_or_west )
    {
       Easting = EW_Unknown;
    }
+
+   if ( Easting == West )
+   {
+      DegreesE7 = -DegreesE7;
+   }
 }
 
 void LONGITUDE::Write( SENTENCE& sentence )
@@ -128,8 +156,10 @@ void LONGITUDE::Write( SENTENCE& sentence )
    else
    {
       /*
-      ** Add Nothing
+      ** Leave the field empty, dropping it would shift the rest
       */
+
+      sentence += wxString();
    }
 }
 
@@ -137,6 +167,7 @@ const LONGITUDE& LONGITUDE::operator = ( const LONGITUDE& source )
 {
 
    Longitude = source.Longitude;
+   DegreesE7 = source.DegreesE7;
    Easting   = source.Easting;
 
    return( *this );
@@ -44,6 +44,7 @@
 MDA::MDA()
 {
    Mnemonic = _T("MDA");
+   SentenceID = SID_MDA;
    Empty();
 }
 
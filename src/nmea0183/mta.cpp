@@ -40,9 +40,18 @@
 
 //IMPLEMENT_DYNAMIC( MTA, RESPONSE )
 
+/*
+** Fields in sentence order
+*/
+
+typedef NMEA0183_SCHEMA<
+   NMEA0183_FIELD( MTA, Temperature, 1 ),
+   NMEA0183_FIELD( MTA, UnitOfMeasurement, 2 ) > MTA_SCHEMA;
+
 MTA::MTA()
 {
    Mnemonic = _T("MTA");
+   SentenceID = SID_MTA;
    Empty();
 }
 
@@ -56,8 +65,7 @@ void MTA::Empty( void )
 {
 //   ASSERT_VALID( this );
 
-   Temperature = 0.0;
-   UnitOfMeasurement.Empty();
+   MTA_SCHEMA::Empty( *this );
 }
 
 bool MTA::Parse( const SENTENCE& sentence )
@@ -81,14 +89,13 @@ bool MTA::Parse( const SENTENCE& sentence )
    ** First we check the checksum...
    */
 
-   if ( sentence.IsChecksumBad( 3 ) == TRUE )
+   if ( sentence.IsChecksumBad( MTA_SCHEMA::End ) == TRUE )
    {
       SetErrorMessage( _T("Invalid Checksum") );
       return( FALSE );
    } 
 
-   Temperature       = sentence.Double( 1 );
-   UnitOfMeasurement = sentence.Field( 2 );
+   MTA_SCHEMA::Parse( sentence, *this );
 
    return( TRUE );
 }
@@ -103,20 +110,29 @@ bool MTA::Write( SENTENCE& sentence )
    
    RESPONSE::Write( sentence );
 
-   sentence += Temperature;
-   sentence += UnitOfMeasurement;
+   MTA_SCHEMA::Write( sentence, *this );
 
    sentence.Finish();
 
    return( TRUE );
 }
 
+int MTA::Encode( char *buffer, int buffer_size, unsigned short talker_code )
+{
+   ENCODER encoder( buffer, buffer_size );
+
+   RESPONSE::Write( encoder, talker_code );
+
+   MTA_SCHEMA::Write( encoder, *this );
+
+   return( encoder.Finish() );
+}
+
 const MTA& MTA::operator = ( const MTA& source )
 {
 //   ASSERT_VALID( this );
 
-   Temperature       = source.Temperature;
-   UnitOfMeasurement = source.UnitOfMeasurement;
+   MTA_SCHEMA::Copy( *this, source );
 
    return( *this );
 }
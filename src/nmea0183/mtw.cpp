@@ -41,9 +41,18 @@
 
 //IMPLEMENT_DYNAMIC( MTW, RESPONSE )
 
+/*
+** Fields in sentence order
+*/
+
+typedef NMEA0183_SCHEMA<
+   NMEA0183_FIELD( MTW, Temperature, 1 ),
+   NMEA0183_FIELD( MTW, UnitOfMeasurement, 2 ) > MTW_SCHEMA;
+
 MTW::MTW()
 {
    Mnemonic = _T("MTW");
+   SentenceID = SID_MTW;
    Empty();
 }
 
@@ -57,8 +66,7 @@ void MTW::Empty( void )
 {
 //   ASSERT_VALID( this );
 
-   Temperature = 0.0;
-   UnitOfMeasurement.Empty();
+   MTW_SCHEMA::Empty( *this );
 }
 
 bool MTW::Parse( const SENTENCE& sentence )
@@ -82,14 +90,13 @@ bool MTW::Parse( const SENTENCE& sentence )
    ** First we check the checksum...
    */
 
-   if ( sentence.IsChecksumBad( 3 ) == TRUE )
+   if ( sentence.IsChecksumBad( MTW_SCHEMA::End ) == TRUE )
    {
       SetErrorMessage( _T("Invalid Checksum") );
       return( FALSE );
    } 
 
-   Temperature       = sentence.Double( 1 );
-   UnitOfMeasurement = sentence.Field( 2 );
+   MTW_SCHEMA::Parse( sentence, *this );
 
    return( TRUE );
 }
@@ -104,20 +111,29 @@ bool MTW::Write( SENTENCE& sentence )
    
    RESPONSE::Write( sentence );
 
-   sentence += Temperature;
-   sentence += UnitOfMeasurement;
+   MTW_SCHEMA::Write( sentence, *this );
 
    sentence.Finish();
 
    return( TRUE );
 }
 
+int MTW::Encode( char *buffer, int buffer_size, unsigned short talker_code )
+{
+   ENCODER encoder( buffer, buffer_size );
+
+   RESPONSE::Write( encoder, talker_code );
+
+   MTW_SCHEMA::Write( encoder, *this );
+
+   return( encoder.Finish() );
+}
+
 const MTW& MTW::operator = ( const MTW& source )
 {
 //   ASSERT_VALID( this );
 
-   Temperature       = source.Temperature;
-   UnitOfMeasurement = source.UnitOfMeasurement;
+   MTW_SCHEMA::Copy( *this, source );
 
    return( *this );
 }
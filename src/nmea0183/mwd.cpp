@@ -33,9 +33,24 @@
 
 //IMPLEMENT_DYNAMIC( MWD, RESPONSE )
 
+/*
+** Fields in sentence order
+*/
+
+typedef NMEA0183_SCHEMA<
+   NMEA0183_FIELD( MWD, WindAngleTrue, 1 ),
+   NMEA0183_UNIT( 2, 'T' ),
+   NMEA0183_FIELD( MWD, WindAngleMagnetic, 3 ),
+   NMEA0183_UNIT( 4, 'M' ),
+   NMEA0183_FIELD( MWD, WindSpeedKnots, 5 ),
+   NMEA0183_UNIT( 6, 'N' ),
+   NMEA0183_FIELD( MWD, WindSpeedms, 7 ),
+   NMEA0183_UNIT( 8, 'M' ) > MWD_SCHEMA;
+
 MWD::MWD()
 {
    Mnemonic = _T("MWD");
+   SentenceID = SID_MWD;
    Empty();
 }
 
@@ -49,10 +64,7 @@ void MWD::Empty( void )
 {
 //   ASSERT_VALID( this );
 
-   WindAngleTrue   = 0.0;
-   WindAngleMagnetic   = 0.0;
-   WindSpeedKnots   = 0.0;
-   WindSpeedms   = 0.0;
+   MWD_SCHEMA::Empty( *this );
 }
 
 bool MWD::Parse( const SENTENCE& sentence )
@@ -82,16 +94,13 @@ bool MWD::Parse( const SENTENCE& sentence )
    ** First we check the checksum...
    */
 
-   if ( sentence.IsChecksumBad( 9 ) == TRUE )
+   if ( sentence.IsChecksumBad( MWD_SCHEMA::End ) == TRUE )
    {
       SetErrorMessage( _T("Invalid Checksum") );
       return( FALSE );
    } 
 
-   WindAngleTrue      = sentence.Double( 1 );
-   WindAngleMagnetic  = sentence.Double( 3 );
-   WindSpeedKnots     = sentence.Double( 5 );
-   WindSpeedms        = sentence.Double( 7 );
+   MWD_SCHEMA::Parse( sentence, *this );
 
    return( TRUE );
 }
@@ -106,28 +115,29 @@ bool MWD::Write( SENTENCE& sentence )
    
    RESPONSE::Write( sentence );
 
-   sentence += WindAngleTrue;
-   sentence += _T("T");
-   sentence += WindAngleMagnetic;
-   sentence += _T("M");
-   sentence += WindSpeedKnots;
-   sentence += _T("N");
-   sentence += WindSpeedms;
-   sentence += _T("M");
+   MWD_SCHEMA::Write( sentence, *this );
 
    sentence.Finish();
 
    return( TRUE );
 }
 
+int MWD::Encode( char *buffer, int buffer_size, unsigned short talker_code )
+{
+   ENCODER encoder( buffer, buffer_size );
+
+   RESPONSE::Write( encoder, talker_code );
+
+   MWD_SCHEMA::Write( encoder, *this );
+
+   return( encoder.Finish() );
+}
+
 const MWD& MWD::operator = ( const MWD& source )
 {
 //   ASSERT_VALID( this );
  
-   WindAngleTrue      = source.WindAngleTrue;
-   WindAngleMagnetic  = source.WindAngleMagnetic;
-   WindSpeedKnots     = source.WindSpeedKnots;
-   WindSpeedms        = source.WindSpeedms;
+   MWD_SCHEMA::Copy( *this, source );
 
    return( *this );
 }
@@ -41,9 +41,21 @@
 
 //IMPLEMENT_DYNAMIC( MWV, RESPONSE )
 
+/*
+** Fields in sentence order
+*/
+
+typedef NMEA0183_SCHEMA<
+   NMEA0183_FIELD( MWV, WindAngle, 1 ),
+   NMEA0183_FIELD( MWV, Reference, 2 ),
+   NMEA0183_FIELD( MWV, WindSpeed, 3 ),
+   NMEA0183_FIELD( MWV, WindSpeedUnits, 4 ),
+   NMEA0183_FIELD( MWV, IsDataValid, 5 ) > MWV_SCHEMA;
+
 MWV::MWV()
 {
    Mnemonic = _T("MWV");
+   SentenceID = SID_MWV;
    Empty();
 }
 
@@ -57,11 +69,7 @@ void MWV::Empty( void )
 {
 //   ASSERT_VALID( this );
 
-   WindAngle   = 0.0;
-   Reference.Empty();
-   WindSpeed   = 0.0;
-   WindSpeedUnits.Empty();
-   IsDataValid = Unknown0183;
+   MWV_SCHEMA::Empty( *this );
 }
 
 bool MWV::Parse( const SENTENCE& sentence )
@@ -88,17 +96,13 @@ bool MWV::Parse( const SENTENCE& sentence )
    ** First we check the checksum...
    */
 
-   if ( sentence.IsChecksumBad( 6 ) == TRUE )
+   if ( sentence.IsChecksumBad( MWV_SCHEMA::End ) == TRUE )
    {
       SetErrorMessage( _T("Invalid Checksum") );
       return( FALSE );
    } 
 
-   WindAngle      = sentence.Double( 1 );
-   Reference      = sentence.Field( 2 );
-   WindSpeed      = sentence.Double( 3 );
-   WindSpeedUnits = sentence.Field( 4 );
-   IsDataValid    = sentence.Boolean( 5 );
+   MWV_SCHEMA::Parse( sentence, *this );
 
    return( TRUE );
 }
@@ -113,26 +117,29 @@ bool MWV::Write( SENTENCE& sentence )
    
    RESPONSE::Write( sentence );
 
-   sentence += WindAngle;
-   sentence += Reference;
-   sentence += WindSpeed;
-   sentence += WindSpeedUnits;
-   sentence += IsDataValid;
+   MWV_SCHEMA::Write( sentence, *this );
 
    sentence.Finish();
 
    return( TRUE );
 }
 
+int MWV::Encode( char *buffer, int buffer_size, unsigned short talker_code )
+{
+   ENCODER encoder( buffer, buffer_size );
+
+   RESPONSE::Write( encoder, talker_code );
+
+   MWV_SCHEMA::Write( encoder, *this );
+
+   return( encoder.Finish() );
+}
+
 const MWV& MWV::operator = ( const MWV& source )
 {
 //   ASSERT_VALID( this );
  
-   WindAngle      = source.WindAngle;
-   Reference      = source.Reference;
-   WindSpeed      = source.WindSpeed;
-   WindSpeedUnits = source.WindSpeedUnits;
-   IsDataValid    = source.IsDataValid;
+   MWV_SCHEMA::Copy( *this, source );
 
    return( *this );
 }
@@ -48,6 +48,9 @@ NMEA0183::NMEA0183()
 {
    initialize();
 
+   checksum_mode = ChecksumLenient;
+   sentence.SetChecksumMode( checksum_mode );
+
 /*
    response_table.Append( (RESPONSE *) &Aam );
    response_table.Append( (RESPONSE *) &Alm );
@@ -96,8 +99,8 @@ NMEA0183::NMEA0183()
 */
    response_table.Append( (RESPONSE *) &Rmb );
    response_table.Append( (RESPONSE *) &Rmc );
-/*
    response_table.Append( (RESPONSE *) &Rot );
+/*
    response_table.Append( (RESPONSE *) &Rpm );
 */
    response_table.Append( (RESPONSE *) &Rsa );
@@ -137,8 +140,8 @@ NMEA0183::NMEA0183()
    response_table.Append( (RESPONSE *) &Zfo );
    response_table.Append( (RESPONSE *) &Ztg );
 */
-   sort_response_table();
    set_container_pointers();
+   build_dispatch_table();
 }
 
 NMEA0183::~NMEA0183()
@@ -151,6 +154,14 @@ void NMEA0183::initialize( void )
 //   ASSERT_VALID( this );
 
    ErrorMessage.Empty();
+   LastMnemonicParsed   = 0;
+   LastMnemonicReceived = 0;
+   LastSentenceParsed   = SID_Unknown;
+   LastSentenceReceived = SID_Unknown;
+   response_received    = (RESPONSE *) NULL;
+   TalkerCode           = 0;
+   received_counted     = false;
+   outcome_counted      = false;
 }
 
 void NMEA0183::set_container_pointers( void )
@@ -174,48 +185,123 @@ void NMEA0183::set_container_pointers( void )
    }
 }
 
-void NMEA0183::sort_response_table( void )
+/*
+** Sentences are dispatched on the packed mnemonic through a small open
+** addressed hash, so finding the parser does not depend on how many
+** sentence types we understand
+*/
+
+static inline unsigned int dispatch_index( unsigned int mnemonic_key )
+{
+   return( ( ( mnemonic_key * 2654435761U ) >> 16 ) & ( NMEA0183_DISPATCH_TABLE_SIZE - 1 ) );
+}
+
+void NMEA0183::build_dispatch_table( void )
 {
 //   ASSERT_VALID( this );
 
-/*
    int index = 0;
-   int number_of_entries_in_table = response_table.GetSize();
 
-   RESPONSE *this_response = (RESPONSE *) NULL;
-   RESPONSE *that_response = (RESPONSE *) NULL;
+   for( index = 0; index < NMEA0183_DISPATCH_TABLE_SIZE; index++ )
+   {
+      dispatch_table[ index ].Key      = 0;
+      dispatch_table[ index ].Response = (RESPONSE *) NULL;
+   }
 
-   bool sorted = FALSE;
+   wxMRLNode *node = response_table.GetFirst();
 
-   while( sorted == FALSE )
+   while( node )
    {
-      sorted = TRUE;
+      RESPONSE *resp = node->GetData();
 
-      index = 0;
+      unsigned int mnemonic_key = 0;
 
-      while( index < number_of_entries_in_table )
+      if ( resp->Mnemonic.Len() == 3 )
+      {
+         mnemonic_key = NMEA0183_MNEMONIC_KEY( (wxChar) resp->Mnemonic[ 0 ], (wxChar) resp->Mnemonic[ 1 ], (wxChar) resp->Mnemonic[ 2 ] );
+      }
+      else if ( resp->Mnemonic == _T("P") )
       {
-         this_response = (RESPONSE *) response_table.Item( index     );
-         that_response = (RESPONSE *) response_table.Item( index + 1 );
+         mnemonic_key = 'P';
+      }
 
-         if ( this_response->Mnemonic.Compare( that_response->Mnemonic ) > 0 )
-         {
-            response_table[ index     ] = that_response;
-            response_table[ index + 1 ] = this_response;
+      if ( mnemonic_key != 0 && find_response( mnemonic_key ) == NULL )
+      {
+         unsigned int slot = dispatch_index( mnemonic_key );
 
-            sorted = FALSE;
+         while( dispatch_table[ slot ].Key != 0 )
+         {
+            slot = ( slot + 1 ) & ( NMEA0183_DISPATCH_TABLE_SIZE - 1 );
          }
 
-         index++;
+         dispatch_table[ slot ].Key      = mnemonic_key;
+         dispatch_table[ slot ].Response = resp;
       }
+
+      node = node->GetNext();
    }
-*/
+}
+
+RESPONSE *NMEA0183::find_response( unsigned int mnemonic_key ) const
+{
+   if ( mnemonic_key == 0 )
+   {
+      return( (RESPONSE *) NULL );
+   }
+
+   unsigned int slot = dispatch_index( mnemonic_key );
+
+   while( dispatch_table[ slot ].Key != 0 )
+   {
+      if ( dispatch_table[ slot ].Key == mnemonic_key )
+      {
+         return( dispatch_table[ slot ].Response );
+      }
+
+      slot = ( slot + 1 ) & ( NMEA0183_DISPATCH_TABLE_SIZE - 1 );
+   }
+
+   return( (RESPONSE *) NULL );
 }
 
 /*
 ** Public Interface
 */
 
+SENTENCE_ID NMEA0183::Identify( unsigned int mnemonic_key ) const
+{
+   /*
+   ** Lets a caller screen raw sentences before handing them over
+   */
+
+   RESPONSE *response_p = find_response( mnemonic_key );
+
+   if ( response_p == NULL )
+   {
+      return( SID_Unknown );
+   }
+
+   return( response_p->SentenceID );
+}
+
+wxString NMEA0183::GetMnemonic( SENTENCE_ID sentence_id ) const
+{
+   wxString mnemonic;
+
+   for( int index = 0; index < NMEA0183_DISPATCH_TABLE_SIZE; index++ )
+   {
+      RESPONSE *response_p = dispatch_table[ index ].Response;
+
+      if ( response_p != NULL && response_p->SentenceID == sentence_id && sentence_id != SID_Unknown )
+      {
+         mnemonic = response_p->Mnemonic;
+         break;
+      }
+   }
+
+   return( mnemonic );
+}
+
 bool NMEA0183::IsGood( void ) const
 {
 //   ASSERT_VALID( this );
@@ -224,7 +310,16 @@ bool NMEA0183::IsGood( void ) const
    ** NMEA 0183 sentences begin with $ and and with CR LF
    */
 
-   if ( sentence.Sentence[ 0 ] != '$' )
+   if ( sentence.Length() < 1 || sentence.Data()[ 0 ] != '$' )
+   {
+      return( FALSE );
+   }
+
+   /*
+   ** Not all of it was indexed, the checksum could be anywhere
+   */
+
+   if ( sentence.IsOversized() )
    {
       return( FALSE );
    }
@@ -251,31 +346,49 @@ bool NMEA0183::IsGood( void ) const
 
 bool NMEA0183::PreParse( void )
 {
-    wxCharBuffer buf = sentence.Sentence.ToUTF8();
-    if( !buf.data() )                            // badly formed sentence?
-        return false;
-    
       if ( IsGood() )
       {
-            wxString mnemonic = sentence.Field( 0 );
+            LastMnemonicReceived = sentence.MnemonicKey();
+            response_received = find_response( LastMnemonicReceived );
 
-      /*
-            ** See if this is a proprietary field
-      */
+            /*
+            ** Parse() comes through here again, the tag block and the
+            ** counters are done once per sentence
+            */
 
-            if ( mnemonic.Left( 1 ) == 'P' )
-                  mnemonic = _T("P");
+            if ( ! received_counted )
+            {
+                  TagBlock.Parse( sentence );
 
-            else
-                  mnemonic = mnemonic.Right( 3 );
+                  SENTENCE_STATISTICS& counts = Statistics.Sentence[ response_received ? response_received->SentenceID : SID_Unknown ];
 
+                  counts.Received++;
+                  counts.Bytes += sentence.Length();
+                  received_counted = true;
+            }
 
-            LastSentenceIDReceived = mnemonic;
+            LastSentenceReceived = response_received ? response_received->SentenceID : SID_Unknown;
 
             return true;
       }
       else
+      {
+            if ( ! received_counted )
+            {
+                  if ( sentence.IsOversized() )
+                  {
+                        Statistics.Oversized++;
+                  }
+                  else
+                  {
+                        Statistics.NotSentences++;
+                  }
+
+                  received_counted = true;
+            }
+
             return false;
+      }
 }
 
 
@@ -285,80 +398,181 @@ bool NMEA0183::Parse( void )
 
    if(PreParse())
    {
+      RESPONSE *response_p = response_received;
 
-      wxString mnemonic = sentence.Field( 0 );
+      if ( response_p == NULL )
+      {
+         ErrorMessage = GetLastSentenceIDReceived();
+         ErrorMessage += _T(" is an unknown type of sentence");
+
+         return( FALSE );
+      }
 
       /*
-      ** See if this is a proprietary field
+      ** Checked here once for every sentence, whatever field number the
+      ** response class itself believes the checksum is in
       */
 
-      if ( mnemonic.Left( 1 ) == 'P' )
+      if ( checksum_mode != ChecksumOff )
+      {
+         NMEA0183_BOOLEAN checksum_bad = sentence.IsChecksumBad();
+
+         if ( checksum_bad == NTrue || ( checksum_bad == Unknown0183 && checksum_mode == ChecksumStrict ) )
+         {
+            if ( ! outcome_counted )
+            {
+               Statistics.Sentence[ response_p->SentenceID ].ChecksumRejects++;
+               outcome_counted = true;
+            }
+
+            ErrorMessage  = response_p->Mnemonic;
+            ErrorMessage += ( checksum_bad == NTrue ) ? _T(", Invalid Checksum") : _T(", Missing Checksum");
+
+            return( FALSE );
+         }
+      }
+
+      bool timed = ( ! outcome_counted && Statistics.StartTiming() );
+      unsigned long long start = timed ? PARSE_STATISTICS::Nanoseconds() : 0;
+
+      return_value = response_p->Parse( sentence );
+
+      if ( timed )
       {
-          mnemonic = _T("P");
+         Statistics.AddParseTime( response_p->SentenceID, PARSE_STATISTICS::Nanoseconds() - start );
       }
-      else
+
+      if ( ! outcome_counted )
       {
-         mnemonic = mnemonic.Right( 3 );
+         if ( return_value == TRUE )
+         {
+            Statistics.Sentence[ response_p->SentenceID ].Parsed++;
+         }
+         else
+         {
+            Statistics.Sentence[ response_p->SentenceID ].FieldErrors++;
+         }
+
+         outcome_counted = true;
       }
 
       /*
-      ** Set up our default error message
+      ** Set your ErrorMessage
       */
 
-      ErrorMessage = mnemonic;
-      ErrorMessage += _T(" is an unknown type of sentence");
+      if ( return_value == TRUE )
+      {
+         /*
+         ** Only written when the last sentence failed, most parse fine
+         */
 
-      LastSentenceIDReceived = mnemonic;
+         if ( ErrorMessage != _T("No Error") )
+         {
+            ErrorMessage = _T("No Error");
+         }
 
-      RESPONSE *response_p = (RESPONSE *) NULL;
+         LastMnemonicParsed = LastMnemonicReceived;
+         LastSentenceParsed = response_p->SentenceID;
+         TalkerCode = TALKER_CODE( sentence.Data()[ 1 ], sentence.Data()[ 2 ] );
 
+         if ( response_p->SentenceID == SID_GSV )
+         {
+            Satellites.Add( Gsv, TalkerCode );
+         }
+      }
+      else
+      {
+         ErrorMessage = response_p->ErrorMessage;
+      }
+   }
+   else
+   {
+      return_value = FALSE;
+   }
 
-//          Traverse the response list to find a mnemonic match
+   return( return_value );
+}
 
-       wxMRLNode *node = response_table.GetFirst();
+static wxString unpack_mnemonic( unsigned int mnemonic_key )
+{
+   /*
+   ** Undo NMEA0183_MNEMONIC_KEY(), 'P' stays a single character
+   */
 
-       int comparison  = 0;
+   wxString mnemonic;
 
-        while(node)
-        {
-           RESPONSE *resp = node->GetData();
+   for( int shift = 16; shift >= 0; shift -= 8 )
+   {
+      wxChar character = (wxChar) ( ( mnemonic_key >> shift ) & 0xFF );
 
-            comparison = mnemonic.Cmp( resp->Mnemonic );
+      if ( character != 0 )
+      {
+         mnemonic += character;
+      }
+   }
 
-            if ( comparison == 0 )
-            {
-                        response_p = (RESPONSE *) resp;
-                        return_value = response_p->Parse( sentence );
-
-                        /*
-                        ** Set your ErrorMessage
-                        */
-
-                        if ( return_value == TRUE )
-                        {
-                           ErrorMessage = _T("No Error");
-                           LastSentenceIDParsed = response_p->Mnemonic;
-                           TalkerID = talker_id( sentence );
-                           ExpandedTalkerID = expand_talker_id( TalkerID );
-                        }
-                        else
-                        {
-                           ErrorMessage = response_p->ErrorMessage;
-                        }
-
-                        break;
-                   }
-
-              node = node->GetNext();
-        }
+   return( mnemonic );
+}
 
-   }
-   else
+wxString NMEA0183::GetLastSentenceIDParsed( void ) const
+{
+   return( unpack_mnemonic( LastMnemonicParsed ) );
+}
+
+wxString NMEA0183::GetLastSentenceIDReceived( void ) const
+{
+   return( unpack_mnemonic( LastMnemonicReceived ) );
+}
+
+wxString NMEA0183::GetTalkerID( void ) const
+{
+   /*
+   ** Only turned back into text when somebody asks
+   */
+
+   wxString talker;
+
+   if ( TalkerCode != 0 )
    {
-      return_value = FALSE;
+      talker += (wxChar) ( TalkerCode >> 8 );
+      talker += (wxChar) ( TalkerCode & 0xFF );
    }
 
-   return( return_value );
+   return( talker );
+}
+
+wxString NMEA0183::GetExpandedTalkerID( void ) const
+{
+   return( expand_talker_id( GetTalkerID() ) );
+}
+
+NMEA0183_CHECKSUM_MODE NMEA0183::GetChecksumMode( void ) const
+{
+   return( checksum_mode );
+}
+
+void NMEA0183::SetChecksumMode( NMEA0183_CHECKSUM_MODE mode )
+{
+//   ASSERT_VALID( this );
+
+   checksum_mode = mode;
+   sentence.SetChecksumMode( mode );
+}
+
+NMEA0183& NMEA0183::Assign( const char *source, int length )
+{
+//   ASSERT_VALID( this );
+
+   /*
+   ** The bytes are parsed in place, keep them alive until the next sentence
+   */
+
+   sentence.Assign( source, length );
+
+   received_counted = false;
+   outcome_counted  = false;
+
+   return( *this );
 }
 
 NMEA0183& NMEA0183::operator << ( wxString & source )
@@ -367,6 +581,9 @@ NMEA0183& NMEA0183::operator << ( wxString & source )
 
    sentence = source;
 
+   received_counted = false;
+   outcome_counted  = false;
+
    return( *this );
 }
 
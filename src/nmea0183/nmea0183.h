@@ -51,6 +51,13 @@
 #include "wx/list.h"
 #include "wx/arrstr.h"
 
+#include <math.h>
+
+#if ! defined( NAN )
+#include <limits>
+#define NAN std::numeric_limits<double>::quiet_NaN()
+#endif
+
 /*
 ** Turn off the warning about precompiled headers, it is rather annoying
 */
@@ -131,6 +138,24 @@ typedef enum _transducertype
    VolumeTransducer              = 'V'
 } TRANSDUCER_TYPE;
 
+typedef enum _fieldstatus
+{
+   FieldEmpty = 0,
+   FieldValid,
+   FieldInvalid
+} NMEA0183_FIELD_STATUS;
+
+/*
+** What NMEA0183::Parse() does with the checksum before a sentence is decoded
+*/
+
+typedef enum _checksummode
+{
+   ChecksumLenient = 0, // Reject bad checksums, accept sentences without one
+   ChecksumStrict,      // Reject bad and missing checksums
+   ChecksumOff          // Do not look at checksums at all
+} NMEA0183_CHECKSUM_MODE;
+
 typedef enum
 {
       RouteUnknown = 0,
@@ -138,15 +163,80 @@ typedef enum
       WorkingRoute
 } ROUTE_TYPE;
 
+/*
+** Sentences we know how to parse, so callers can switch on an integer
+** instead of comparing mnemonic strings
+*/
+
+typedef enum _sentenceid
+{
+   SID_Unknown = 0,
+   SID_DBT,
+   SID_DPT,
+   SID_GGA,
+   SID_GLL,
+   SID_GSV,
+   SID_HDG,
+   SID_HDM,
+   SID_HDT,
+   SID_MDA,
+   SID_MTA,
+   SID_MTW,
+   SID_MWD,
+   SID_MWV,
+   SID_RMB,
+   SID_RMC,
+   SID_ROT,
+   SID_RSA,
+   SID_RTE,
+   SID_VHW,
+   SID_VLW,
+   SID_VTG,
+   SID_VWR,
+   SID_VWT,
+   SID_WPL,
+   SID_ZDA,
+   SID_Count // Not a sentence, keep this last
+} SENTENCE_ID;
+
+/*
+** A mnemonic packed into an integer, 'P' alone for proprietary sentences
+*/
+
+#define NMEA0183_MNEMONIC_KEY( a, b, c ) ( ( (unsigned int) (a) << 16 ) | ( (unsigned int) (b) << 8 ) | (unsigned int) (c) )
+
+/*
+** The two character talker identifier ($GPGGA) packed the same way
+*/
+
+#define TALKER_CODE( a, b ) ( (unsigned short) ( ( (unsigned int) (a) << 8 ) | (unsigned int) (b) ) )
+
+typedef enum _constellation
+{
+   ConstellationUnknown = 0,
+   ConstellationGPS,     // Including SBAS
+   ConstellationGLONASS,
+   ConstellationGalileo,
+   ConstellationBeiDou,
+   ConstellationQZSS,
+   ConstellationNavIC,
+   ConstellationCount // Not a constellation, keep this last
+} CONSTELLATION;
+
 /*
 ** Misc Function Prototypes
 */
 
 int HexValue( const wxString& hex_string );
 
-wxString& expand_talker_id( const wxString & );
-wxString& Hex( int value );
-wxString& talker_id( const wxString& sentence );
+NMEA0183_FIELD_STATUS decode_double( const char *field, int length, double& value );
+NMEA0183_FIELD_STATUS decode_integer( const char *field, int length, int& value );
+NMEA0183_FIELD_STATUS decode_coordinate( const char *field, int length, int maximum_degrees, int& degrees_e7 );
+unsigned char compute_checksum( const char *data, int length );
+
+wxString expand_talker_id( const wxString & );
+const char *talker_description( unsigned short talker_code );
+wxString talker_id( const wxString& sentence );
 
 #include "nmea0183.hpp"
 
@@ -48,6 +48,13 @@
 #include "Sentence.hpp"
 #include "Response.hpp"
 #include "LatLong.hpp"
+#include "Encoder.hpp"
+#include "Schema.hpp"
+#include "Framer.hpp"
+#include "Route.hpp"
+#include "TagBlock.hpp"
+#include "Stats.hpp"
+#include "BulkDecoder.hpp"
 //#include "LoranTD.hpp"
 //#include "Manufact.hpp"
 //#include "MList.hpp"
@@ -113,8 +120,9 @@
 #include "zda.hpp"
 #include "vlw.hpp"
 #include "xte.hpp"
+#include "rot.hpp"
+#include "SatTable.hpp"
 /*
-#include "ROT.hpp"
 #include "RPM.hpp"
 #include "RSD.hpp"
 #include "SFI.hpp"
@@ -139,21 +147,40 @@
 
 WX_DECLARE_LIST(RESPONSE, MRL);
 
+/*
+** Open addressed hash of packed mnemonics, a power of two comfortably
+** larger than the number of sentences we understand
+*/
+
+#define NMEA0183_DISPATCH_TABLE_SIZE 64
+
+typedef struct
+{
+   unsigned int Key;
+   RESPONSE    *Response;
+} MNEMONIC_DISPATCH;
+
 class NMEA0183
 {
 
    private:
 
       SENTENCE sentence;
+      RESPONSE *response_received; // Parser for the sentence PreParse() last saw
+      NMEA0183_CHECKSUM_MODE checksum_mode;
+      bool received_counted; // The sentence is in Statistics as received
+      bool outcome_counted;  // ... and as parsed or rejected
 
       void initialize( void );
 
    protected:
 
       MRL response_table;
+      MNEMONIC_DISPATCH dispatch_table[ NMEA0183_DISPATCH_TABLE_SIZE ];
 
       void set_container_pointers( void );
-      void sort_response_table( void );
+      void build_dispatch_table( void );
+      RESPONSE *find_response( unsigned int mnemonic_key ) const;
 
    public:
 
@@ -212,8 +239,8 @@ class NMEA0183
 */
       RMB Rmb;
       RMC Rmc;
-/*
       ROT Rot;
+/*
       RPM Rpm;
 */
       RSA Rsa;
@@ -254,18 +281,35 @@ class NMEA0183
       ZTG Ztg;
 */
       wxString ErrorMessage; // Filled when Parse returns FALSE
-      wxString LastSentenceIDParsed; // ID of the lst sentence successfully parsed
-      wxString LastSentenceIDReceived; // ID of the last sentence received, may not have parsed successfully
+      unsigned int LastMnemonicParsed;   // NMEA0183_MNEMONIC_KEY() of the last sentence successfully parsed
+      unsigned int LastMnemonicReceived; // ... of the last sentence received, may not have parsed successfully
+      SENTENCE_ID LastSentenceParsed;   // Same as LastMnemonicParsed, SID_Unknown if not understood
+      SENTENCE_ID LastSentenceReceived; // Same as LastMnemonicReceived, SID_Unknown if not understood
+
+      unsigned short TalkerCode; // TALKER_CODE() of the last sentence parsed
 
-      wxString TalkerID;
-      wxString ExpandedTalkerID;
+      TAG_BLOCK TagBlock; // NMEA 4 tag block of the last sentence received, if it had one
+
+      SATELLITE_TABLE Satellites; // Every GSV cycle parsed, across talkers
+
+      PARSE_STATISTICS Statistics; // Per sentence type counters
 
 //      MANUFACTURER_LIST Manufacturers;
 
+      SENTENCE_ID Identify( unsigned int mnemonic_key ) const;
+      wxString GetMnemonic( SENTENCE_ID sentence_id ) const;
+      wxString GetLastSentenceIDParsed( void ) const;
+      wxString GetLastSentenceIDReceived( void ) const;
+      wxString GetTalkerID( void ) const;
+      wxString GetExpandedTalkerID( void ) const;
       bool IsGood( void ) const;
       bool Parse( void );
       bool PreParse( void );
 
+      NMEA0183_CHECKSUM_MODE GetChecksumMode( void ) const;
+      void SetChecksumMode( NMEA0183_CHECKSUM_MODE mode );
+
+      NMEA0183& Assign( const char *source, int length );
       NMEA0183& operator << ( wxString& source );
       NMEA0183& operator >> ( wxString& destination );
 };
@@ -43,6 +43,8 @@
 
 RESPONSE::RESPONSE()
 {
+   container_p = (NMEA0183 *) NULL;
+   SentenceID = SID_Unknown;
    Talker.Empty();
    ErrorMessage.Empty();
 }
@@ -77,18 +79,68 @@ bool RESPONSE::Write( SENTENCE& sentence )
     if(NULL == container_p)
           sentence.Sentence.Append(_T("--"));
     else
-          sentence.Sentence.Append(container_p->TalkerID);
+          sentence.Sentence.Append(container_p->GetTalkerID());
 
     sentence.Sentence.Append(Mnemonic);
 
    return( TRUE );
 }
 
-const wxString& RESPONSE::PlainEnglish( void )
+void RESPONSE::Write( ENCODER& encoder, unsigned short talker_code )
 {
-   static wxString return_string;
+   /*
+   ** Same address as above, unless the caller wants its own talker
+   */
+
+   if ( talker_code == 0 && container_p != NULL )
+   {
+      talker_code = container_p->TalkerCode;
+   }
+
+   encoder.Begin( talker_code, Mnemonic );
+}
+
+int RESPONSE::Encode( char *buffer, int buffer_size, unsigned short talker_code )
+{
+   /*
+   ** Sentences without a schema go through Write() and are copied over,
+   ** the fields only, so the talker and checksum can be redone
+   */
+
+   SENTENCE sentence;
+
+   if ( ! Write( sentence ) )
+   {
+      return( 0 );
+   }
 
-   return_string.Empty();
+   ENCODER encoder( buffer, buffer_size );
+
+   Write( encoder, talker_code );
+
+   int length = (int) sentence.Sentence.Len();
+   int first  = 0;
+
+   while( first < length && sentence.Sentence[ first ] != ',' )
+   {
+      first++;
+   }
+
+   int last = first;
+
+   while( last < length && sentence.Sentence[ last ] != '*' )
+   {
+      last++;
+   }
+
+   encoder.Append( sentence.Sentence, first, last );
+
+   return( encoder.Finish() );
+}
+
+wxString RESPONSE::PlainEnglish( void )
+{
+   wxString return_string;
 
    return( return_string );
 }
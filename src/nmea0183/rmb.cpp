@@ -41,9 +41,26 @@
 */
 
 
+/*
+** Fields in sentence order
+*/
+
+typedef NMEA0183_SCHEMA<
+   NMEA0183_FIELD( RMB, IsDataValid, 1 ),
+   NMEA0183_FIELD( RMB, CrossTrackError, 2 ),
+   NMEA0183_FIELD( RMB, DirectionToSteer, 3 ),
+   NMEA0183_FIELD( RMB, From, 4 ),
+   NMEA0183_FIELD( RMB, To, 5 ),
+   NMEA0183_FIELD( RMB, DestinationPosition, 6 ),
+   NMEA0183_FIELD( RMB, RangeToDestinationNauticalMiles, 10 ),
+   NMEA0183_FIELD( RMB, BearingToDestinationDegreesTrue, 11 ),
+   NMEA0183_FIELD( RMB, DestinationClosingVelocityKnots, 12 ),
+   NMEA0183_FIELD( RMB, IsArrivalCircleEntered, 13 ) > RMB_SCHEMA;
+
 RMB::RMB()
 {
     Mnemonic = _T("RMB");
+    SentenceID = SID_RMB;
    Empty();
 }
 
@@ -55,17 +72,7 @@ RMB::~RMB()
 
 void RMB::Empty( void )
 {
-
-   IsDataValid                     = Unknown0183;
-   CrossTrackError                 = 0.0;
-   DirectionToSteer                = LR_Unknown;
-   To.Empty();
-   From.Empty();
-   DestinationPosition.Empty();
-   RangeToDestinationNauticalMiles = 0.0;
-   BearingToDestinationDegreesTrue = 0.0;
-   DestinationClosingVelocityKnots = 0.0;
-   IsArrivalCircleEntered          = Unknown0183;
+   RMB_SCHEMA::Empty( *this );
 }
 
 bool RMB::Parse( const SENTENCE& sentence )
@@ -99,7 +106,7 @@ bool RMB::Parse( const SENTENCE& sentence )
    ** First we check the checksum...
    */
 
-   NMEA0183_BOOLEAN check = sentence.IsChecksumBad( 14 );
+   NMEA0183_BOOLEAN check = sentence.IsChecksumBad( RMB_SCHEMA::End );
 
    if ( check == NTrue )
    {
@@ -115,16 +122,7 @@ bool RMB::Parse( const SENTENCE& sentence )
    }
 */
 
-   IsDataValid                     = sentence.Boolean( 1 );
-   CrossTrackError                 = sentence.Double( 2 );
-   DirectionToSteer                = sentence.LeftOrRight( 3 );
-   From                            = sentence.Field( 4 );
-   To                              = sentence.Field( 5 );
-   DestinationPosition.Parse( 6, 7, 8, 9, sentence );
-   RangeToDestinationNauticalMiles = sentence.Double( 10 );
-   BearingToDestinationDegreesTrue = sentence.Double( 11 );
-   DestinationClosingVelocityKnots = sentence.Double( 12 );
-   IsArrivalCircleEntered          = sentence.Boolean( 13 );
+   RMB_SCHEMA::Parse( sentence, *this );
 
    return( TRUE );
 }
@@ -138,20 +136,7 @@ bool RMB::Write( SENTENCE& sentence )
 
    RESPONSE::Write( sentence );
 
-   sentence += IsDataValid;
-   sentence += CrossTrackError;
-   if(DirectionToSteer == Left)
-       sentence += _T("L");
-   else
-       sentence += _T("R");
-
-   sentence += From;
-   sentence += To;
-   sentence += DestinationPosition;
-   sentence += RangeToDestinationNauticalMiles;
-   sentence += BearingToDestinationDegreesTrue;
-   sentence += DestinationClosingVelocityKnots;
-   sentence += IsArrivalCircleEntered;
+   RMB_SCHEMA::Write( sentence, *this );
 
    sentence.Finish();
 
@@ -160,19 +145,21 @@ bool RMB::Write( SENTENCE& sentence )
    return( TRUE );
 }
 
+int RMB::Encode( char *buffer, int buffer_size, unsigned short talker_code )
+{
+   ENCODER encoder( buffer, buffer_size );
+
+   RESPONSE::Write( encoder, talker_code );
+
+   RMB_SCHEMA::Write( encoder, *this );
+
+   return( encoder.Finish() );
+}
+
 const RMB& RMB::operator = ( const RMB& source )
 {
 
-   IsDataValid                     = source.IsDataValid;
-   CrossTrackError                 = source.CrossTrackError;
-   DirectionToSteer                = source.DirectionToSteer;
-   From                            = source.From;
-   To                              = source.To;
-   DestinationPosition             = source.DestinationPosition;
-   RangeToDestinationNauticalMiles = source.RangeToDestinationNauticalMiles;
-   BearingToDestinationDegreesTrue = source.BearingToDestinationDegreesTrue;
-   DestinationClosingVelocityKnots = source.DestinationClosingVelocityKnots;
-   IsArrivalCircleEntered          = source.IsArrivalCircleEntered;
+   RMB_SCHEMA::Copy( *this, source );
 
   return( *this );
 }
@@ -41,9 +41,24 @@
 */
 
 
+/*
+** Fields in sentence order
+*/
+
+typedef NMEA0183_SCHEMA<
+   NMEA0183_FIELD( RMC, UTCTime, 1 ),
+   NMEA0183_FIELD( RMC, IsDataValid, 2 ),
+   NMEA0183_FIELD( RMC, Position, 3 ),
+   NMEA0183_FIELD( RMC, SpeedOverGroundKnots, 7 ),
+   NMEA0183_FIELD( RMC, TrackMadeGoodDegreesTrue, 8 ),
+   NMEA0183_FIELD( RMC, Date, 9 ),
+   NMEA0183_FIELD( RMC, MagneticVariation, 10 ),
+   NMEA0183_FIELD( RMC, MagneticVariationDirection, 11 ) > RMC_SCHEMA;
+
 RMC::RMC()
 {
     Mnemonic = _T("RMC");
+    SentenceID = SID_RMC;
    Empty();
 }
 
@@ -55,15 +70,7 @@ RMC::~RMC()
 
 void RMC::Empty( void )
 {
-
-   UTCTime.Empty();
-   IsDataValid                = Unknown0183;
-   SpeedOverGroundKnots       = 0.0;
-   Position.Empty();
-   TrackMadeGoodDegreesTrue   = 0.0;
-   Date.Empty();
-   MagneticVariation          = 0.0;
-   MagneticVariationDirection = EW_Unknown;
+   RMC_SCHEMA::Empty( *this );
 }
 
 bool RMC::Parse( const SENTENCE& sentence )
@@ -104,50 +111,25 @@ bool RMC::Parse( const SENTENCE& sentence )
    ** First we check the checksum...
    */
 
-   NMEA0183_BOOLEAN check = sentence.IsChecksumBad( 12 );
-
-   if ( check == NTrue )
+   if ( sentence.IsChecksumBad( RMC_SCHEMA::End ) == NTrue )
    {
-   /*
-   ** This may be an NMEA Version 2.3 sentence, with "Mode" field
-   */
-       wxString checksum_in_sentence = sentence.Field( 12 );
-       if(checksum_in_sentence.StartsWith(_T("*")))       // Field is a valid erroneous checksum
-       {
-         SetErrorMessage( _T("Invalid Checksum") );
-         return( FALSE );
-       }
-       else
-       {
-         check = sentence.IsChecksumBad( 13 );
-         if( check == NTrue)
-         {
-            SetErrorMessage( _T("Invalid Checksum") );
-            return( FALSE );
-         }
-       }
+      SetErrorMessage( _T("Invalid Checksum") );
+      return( FALSE );
    }
 
    //   Is this a 2.3 message?
    bool bext_valid = true;
-   wxString checksum_in_sentence = sentence.Field( 12 );
+   wxString checksum_in_sentence = sentence.Field( RMC_SCHEMA::End );
    if(!checksum_in_sentence.StartsWith(_T("*"))) {
        if(checksum_in_sentence == _T("N") )
             bext_valid = false;
     }
 
-   UTCTime                    = sentence.Field( 1 );
-   IsDataValid                = sentence.Boolean( 2 );
+   RMC_SCHEMA::Parse( sentence, *this );
+
    if( !bext_valid )
        IsDataValid = NFalse;
 
-   Position.Parse( 3, 4, 5, 6, sentence );
-   SpeedOverGroundKnots       = sentence.Double( 7 );
-   TrackMadeGoodDegreesTrue   = sentence.Double( 8 );
-   Date                       = sentence.Field( 9 );
-   MagneticVariation          = sentence.Double( 10 );
-   MagneticVariationDirection = sentence.EastOrWest( 11 );
-
    return( TRUE );
 }
 
@@ -161,32 +143,29 @@ bool RMC::Write( SENTENCE& sentence )
 
    RESPONSE::Write( sentence );
 
-   sentence += UTCTime;
-   sentence += IsDataValid;
-   sentence += Position;
-   sentence += SpeedOverGroundKnots;
-   sentence += TrackMadeGoodDegreesTrue;
-   sentence += Date;
-   sentence += MagneticVariation;
-   sentence += MagneticVariationDirection;
+   RMC_SCHEMA::Write( sentence, *this );
 
    sentence.Finish();
 
    return( TRUE );
 }
 
+int RMC::Encode( char *buffer, int buffer_size, unsigned short talker_code )
+{
+   ENCODER encoder( buffer, buffer_size );
+
+   RESPONSE::Write( encoder, talker_code );
+
+   RMC_SCHEMA::Write( encoder, *this );
+
+   return( encoder.Finish() );
+}
+
 const RMC& RMC::operator = ( const RMC& source )
 {
 //   ASSERT_VALID( this );
 
-   UTCTime                    = source.UTCTime;
-   IsDataValid                = source.IsDataValid;
-   Position                   = source.Position;
-   SpeedOverGroundKnots       = source.SpeedOverGroundKnots;
-   TrackMadeGoodDegreesTrue   = source.TrackMadeGoodDegreesTrue;
-   Date                       = source.Date;
-   MagneticVariation          = source.MagneticVariation;
-   MagneticVariationDirection = source.MagneticVariationDirection;
+   RMC_SCHEMA::Copy( *this, source );
 
   return( *this );
 }
@@ -0,0 +1,119 @@
+/***************************************************************************
+ *
+ * Project:  OpenCPN
+ * Purpose:  NMEA0183 Support Classes
+ * Author:   Sean D'Epagnier
+ *
+ ***************************************************************************
+ *   Copyright (C) 2018 by Sean D'Epagnier                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.             *
+ ***************************************************************************
+ */
+
+
+
+#include "nmea0183.h"
+
+/*
+** Fields in sentence order
+*/
+
+typedef NMEA0183_SCHEMA<
+   NMEA0183_FIELD( ROT, RateOfTurn, 1 ),
+   NMEA0183_FIELD( ROT, IsDataValid, 2 ) > ROT_SCHEMA;
+
+ROT::ROT()
+{
+   Mnemonic = _T("ROT");
+   SentenceID = SID_ROT;
+   Empty();
+}
+
+ROT::~ROT()
+{
+   Mnemonic.Empty();
+   Empty();
+}
+
+void ROT::Empty( void )
+{
+   ROT_SCHEMA::Empty( *this );
+}
+
+bool ROT::Parse( const SENTENCE& sentence )
+{
+
+   /*
+   ** ROT - Rate Of Turn
+   **
+   **        1   2 3
+   **        |   | |
+   ** $--ROT,x.x,A*hh<CR><LF>
+   **
+   ** Field Number:
+   **  1) Rate Of Turn, degrees per minute, "-" means bow turns to port
+   **  2) Status, A means data is valid
+   **  3) Checksum
+   */
+
+   /*
+   ** First we check the checksum...
+   */
+
+   if ( sentence.IsChecksumBad( ROT_SCHEMA::End ) == TRUE )
+   {
+      SetErrorMessage( _T("Invalid Checksum") );
+      return( FALSE );
+   }
+
+   ROT_SCHEMA::Parse( sentence, *this );
+
+   return( TRUE );
+}
+
+bool ROT::Write( SENTENCE& sentence )
+{
+   /*
+   ** Let the parent do its thing
+   */
+
+   RESPONSE::Write( sentence );
+
+   ROT_SCHEMA::Write( sentence, *this );
+
+   sentence.Finish();
+
+   return( TRUE );
+}
+
+int ROT::Encode( char *buffer, int buffer_size, unsigned short talker_code )
+{
+   ENCODER encoder( buffer, buffer_size );
+
+   RESPONSE::Write( encoder, talker_code );
+
+   ROT_SCHEMA::Write( encoder, *this );
+
+   return( encoder.Finish() );
+}
+
+const ROT& ROT::operator = ( const ROT& source )
+{
+   ROT_SCHEMA::Copy( *this, source );
+
+   return( *this );
+}
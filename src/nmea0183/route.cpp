@@ -0,0 +1,235 @@
+/***************************************************************************
+ *
+ * Project:  OpenCPN
+ * Purpose:  NMEA0183 Support Classes
+ * Author:   Sean D'Epagnier
+ *
+ ***************************************************************************
+ *   Copyright (C) 2018 by Sean D'Epagnier                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.             *
+ ***************************************************************************
+ */
+
+
+
+#include "nmea0183.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+ROUTE::ROUTE()
+{
+   arena               = (char *) NULL;
+   arena_size          = 0;
+   arena_used          = 0;
+   offsets             = (int *) NULL;
+   offsets_size        = 0;
+   number_of_waypoints = 0;
+   name[ 0 ]           = 0x00;
+   TypeOfRoute         = RouteUnknown;
+}
+
+ROUTE::~ROUTE()
+{
+   ::free( arena );
+   ::free( offsets );
+}
+
+void ROUTE::Clear( void )
+{
+   arena_used          = 0;
+   number_of_waypoints = 0;
+}
+
+bool ROUTE::reserve( int characters )
+{
+   if ( arena_used + characters > arena_size )
+   {
+      int new_size = ( arena_size > 0 ) ? arena_size : 256;
+
+      while( arena_used + characters > new_size )
+      {
+         new_size *= 2;
+      }
+
+      char *new_arena = (char *) ::realloc( arena, new_size );
+
+      if ( new_arena == NULL )
+      {
+         return( false );
+      }
+
+      arena      = new_arena;
+      arena_size = new_size;
+   }
+
+   if ( number_of_waypoints >= offsets_size )
+   {
+      int new_size = ( offsets_size > 0 ) ? offsets_size * 2 : 32;
+
+      int *new_offsets = (int *) ::realloc( offsets, new_size * sizeof( int ) );
+
+      if ( new_offsets == NULL )
+      {
+         return( false );
+      }
+
+      offsets      = new_offsets;
+      offsets_size = new_size;
+   }
+
+   return( true );
+}
+
+bool ROUTE::Add( const char *identifier, int length )
+{
+   if ( length < 0 )
+   {
+      length = 0;
+   }
+
+   if ( ! reserve( length + 1 ) )
+   {
+      return( false );
+   }
+
+   offsets[ number_of_waypoints++ ] = arena_used;
+
+   if ( length > 0 )
+   {
+      ::memcpy( arena + arena_used, identifier, length );
+   }
+
+   arena[ arena_used + length ] = 0x00;
+   arena_used += length + 1;
+
+   return( true );
+}
+
+bool ROUTE::Add( const wxString& identifier )
+{
+   int length = (int) identifier.Len();
+
+   if ( ! reserve( length + 1 ) )
+   {
+      return( false );
+   }
+
+   offsets[ number_of_waypoints++ ] = arena_used;
+
+   for( int index = 0; index < length; index++ )
+   {
+      wxChar character = identifier[ index ];
+      arena[ arena_used + index ] = ( character < 0x80 ) ? (char) character : '?';
+   }
+
+   arena[ arena_used + length ] = 0x00;
+   arena_used += length + 1;
+
+   return( true );
+}
+
+int ROUTE::GetCount( void ) const
+{
+   return( number_of_waypoints );
+}
+
+const char *ROUTE::GetName( void ) const
+{
+   return( name );
+}
+
+bool ROUTE::IsNamed( const char *route_name, int length ) const
+{
+   if ( length < 0 )
+   {
+      length = 0;
+   }
+
+   if ( length > ROUTE_NAME_LENGTH )
+   {
+      length = ROUTE_NAME_LENGTH;
+   }
+
+   return( ::strncmp( name, route_name, length ) == 0 && name[ length ] == 0x00 );
+}
+
+void ROUTE::SetName( const char *route_name, int length )
+{
+   if ( length < 0 )
+   {
+      length = 0;
+   }
+
+   if ( length > ROUTE_NAME_LENGTH )
+   {
+      length = ROUTE_NAME_LENGTH;
+   }
+
+   if ( length > 0 )
+   {
+      ::memcpy( name, route_name, length );
+   }
+
+   name[ length ] = 0x00;
+}
+
+void ROUTE::Swap( ROUTE& other )
+{
+   char *swap_arena = arena;
+   arena            = other.arena;
+   other.arena      = swap_arena;
+
+   int *swap_offsets = offsets;
+   offsets           = other.offsets;
+   other.offsets     = swap_offsets;
+
+   int swap_value = arena_size;
+   arena_size       = other.arena_size;
+   other.arena_size = swap_value;
+
+   swap_value       = arena_used;
+   arena_used       = other.arena_used;
+   other.arena_used = swap_value;
+
+   swap_value         = offsets_size;
+   offsets_size       = other.offsets_size;
+   other.offsets_size = swap_value;
+
+   swap_value                = number_of_waypoints;
+   number_of_waypoints       = other.number_of_waypoints;
+   other.number_of_waypoints = swap_value;
+
+   char swap_name[ ROUTE_NAME_LENGTH + 1 ];
+   ::memcpy( swap_name, name, sizeof( name ) );
+   ::memcpy( name, other.name, sizeof( name ) );
+   ::memcpy( other.name, swap_name, sizeof( name ) );
+
+   ROUTE_TYPE swap_type = TypeOfRoute;
+   TypeOfRoute          = other.TypeOfRoute;
+   other.TypeOfRoute    = swap_type;
+}
+
+const char *ROUTE::operator [] ( int index ) const
+{
+   if ( index < 0 || index >= number_of_waypoints )
+   {
+      return( "" );
+   }
+
+   return( arena + offsets[ index ] );
+}
@@ -42,9 +42,20 @@
 
 //IMPLEMENT_DYNAMIC( RSA, RESPONSE )
 
+/*
+** Fields in sentence order
+*/
+
+typedef NMEA0183_SCHEMA<
+   NMEA0183_FIELD( RSA, Starboard, 1 ),
+   NMEA0183_FIELD( RSA, IsStarboardDataValid, 2 ),
+   NMEA0183_FIELD( RSA, Port, 3 ),
+   NMEA0183_FIELD( RSA, IsPortDataValid, 4 ) > RSA_SCHEMA;
+
 RSA::RSA()
 {
    Mnemonic = _T("RSA");
+   SentenceID = SID_RSA;
    Empty();
 }
 
@@ -58,10 +69,7 @@ void RSA::Empty( void )
 {
 //   ASSERT_VALID( this );
 
-   Starboard            = 0.0;
-   IsStarboardDataValid = Unknown0183;
-   Port                 = 0.0;
-   IsPortDataValid      = Unknown0183;
+   RSA_SCHEMA::Empty( *this );
 }
 
 bool RSA::Parse( const SENTENCE& sentence )
@@ -87,16 +95,13 @@ bool RSA::Parse( const SENTENCE& sentence )
    ** First we check the checksum...
    */
 
-   if ( sentence.IsChecksumBad( 5 ) == TRUE )
+   if ( sentence.IsChecksumBad( RSA_SCHEMA::End ) == TRUE )
    {
       SetErrorMessage( _T("Invalid Checksum") );
       return( FALSE );
    } 
 
-   Starboard            = sentence.Double(  1 );
-   IsStarboardDataValid = sentence.Boolean( 2 );
-   Port                 = sentence.Double(  3 );
-   IsPortDataValid      = sentence.Boolean( 4 );
+   RSA_SCHEMA::Parse( sentence, *this );
 
    return( TRUE );
 }
@@ -111,24 +116,29 @@ bool RSA::Write( SENTENCE& sentence )
    
    RESPONSE::Write( sentence );
 
-   sentence += Starboard;
-   sentence += IsStarboardDataValid;
-   sentence += Port;
-   sentence += IsPortDataValid;
+   RSA_SCHEMA::Write( sentence, *this );
    
    sentence.Finish();
 
    return( TRUE );
 }
 
+int RSA::Encode( char *buffer, int buffer_size, unsigned short talker_code )
+{
+   ENCODER encoder( buffer, buffer_size );
+
+   RESPONSE::Write( encoder, talker_code );
+
+   RSA_SCHEMA::Write( encoder, *this );
+
+   return( encoder.Finish() );
+}
+
 const RSA& RSA::operator = ( const RSA& source )
 {
 //   ASSERT_VALID( this );
 
-   Starboard            = source.Starboard;
-   IsStarboardDataValid = source.IsStarboardDataValid;
-   Port                 = source.Port;
-   IsPortDataValid      = source.IsPortDataValid;
+   RSA_SCHEMA::Copy( *this, source );
 
    return( *this );
 }
@@ -44,6 +44,7 @@
 RTE::RTE()
 {
    Mnemonic = _T("RTE");
+   SentenceID = SID_RTE;
    Empty();
 }
 
@@ -55,15 +56,23 @@ RTE::~RTE()
 
 void RTE::Empty( void )
 {
-   total_number_of_messages     = 0;
-   last_message_number_received = 0;
-   message_number               = 0;
-   last_waypoint_number_written = 0;
+   total_number_of_messages      = 0;
+   last_message_number_received  = 0;
+   last_total_number_of_messages = 0;
+   message_number                = 0;
+   last_waypoint_number_written  = 0;
 
    TypeOfRoute = RouteUnknown;
    RouteName.Empty();
 
    delete_all_entries();
+   Waypoints.SetName( "", 0 );
+   assembling.Clear();
+   Route.Clear();
+   Route.SetName( "", 0 );
+   Route.TypeOfRoute = RouteUnknown;
+   Routes            = 0;
+   BrokenRoutes      = 0;
 }
 
 bool RTE::Parse( const SENTENCE& sentence )
@@ -88,29 +97,16 @@ bool RTE::Parse( const SENTENCE& sentence )
 
    delete_all_entries();
 
-   int field_number = 1;
-
    total_number_of_messages = sentence.Integer( 1 );
-//   total_number_of_messages = sentence.Double( 1 );
-
-   int this_message_number = sentence.Integer( 2 );
-//   double this_message_number = sentence.Double( 2 );
-
-   if ( this_message_number == 1 )
-   {
-      /*
-      ** Make sure we've got a clean list
-      */
-
-      delete_all_entries();
-   }
+   message_number           = sentence.Integer( 2 );
 
+   const char *data = NULL;
 
-   if ( sentence.Field( 3 ).StartsWith(_T("c")) )
+   if ( sentence.FieldData( 3, data ) > 0 && data[ 0 ] == 'c' )
    {
       TypeOfRoute = CompleteRoute;
    }
-   else if ( sentence.Field( 3 ).StartsWith(_T("w")))
+   else if ( sentence.FieldData( 3, data ) > 0 && data[ 0 ] == 'w' )
    {
       TypeOfRoute = WorkingRoute;
    }
@@ -119,17 +115,83 @@ bool RTE::Parse( const SENTENCE& sentence )
       TypeOfRoute = RouteUnknown;
    }
 
-   RouteName = sentence.Field( 4 );
+   /*
+   ** A route is sent over and over under the same name, only build a new
+   ** wxString when it changes
+   */
+
+   int length = sentence.FieldData( 4, data );
+
+   if ( ! Waypoints.IsNamed( data, length ) )
+   {
+      Waypoints.SetName( data, length );
+      RouteName = wxString::FromAscii( data, length );
+   }
+
+   /*
+   ** Put the route together, a message out of sequence throws away what
+   ** was collected so far
+   */
+
+   if ( message_number == 1 )
+   {
+      if ( last_message_number_received != 0 )
+      {
+         BrokenRoutes++;
+      }
+
+      assembling.Clear();
+      assembling.SetName( data, length );
+      assembling.TypeOfRoute = TypeOfRoute;
+   }
+   else if ( last_message_number_received == 0 ||
+             message_number != last_message_number_received + 1 ||
+             total_number_of_messages != last_total_number_of_messages ||
+             ! assembling.IsNamed( data, length ) )
+   {
+      if ( last_message_number_received != 0 )
+      {
+         BrokenRoutes++;
+      }
+
+      last_message_number_received = 0;
+   }
+
+   bool collecting = ( message_number == 1 || last_message_number_received != 0 );
 
    int number_of_data_fields = sentence.GetNumberOfDataFields();
-   field_number = 5;
 
-   while( field_number < number_of_data_fields )
+   for( int field_number = 5; field_number <= number_of_data_fields; field_number++ )
+   {
+      length = sentence.FieldData( field_number, data );
+      Waypoints.Add( data, length );
+
+      if ( collecting )
+      {
+         assembling.Add( data, length );
+      }
+   }
+
+   if ( ! collecting )
+   {
+      return( TRUE );
+   }
+
+   if ( message_number < total_number_of_messages )
    {
-      Waypoints.Add( ( sentence.Field( field_number ) )) ;
-      field_number++;
+      last_message_number_received  = message_number;
+      last_total_number_of_messages = total_number_of_messages;
+      return( TRUE );
    }
 
+   /*
+   ** Complete, the old route's arena becomes the next one to assemble into
+   */
+
+   Route.Swap( assembling );
+   Routes++;
+   last_message_number_received = 0;
+
    return( TRUE );
 }
 
@@ -166,8 +228,8 @@ bool RTE::Write( SENTENCE& sentence )
 
    sentence += RouteName;
 
-   for(unsigned int i=0 ; i < Waypoints.GetCount() ; i++)
-         sentence += Waypoints[i];
+   for(int i=0 ; i < Waypoints.GetCount() ; i++)
+         sentence += wxString::FromAscii( Waypoints[i] );
 
    sentence.Finish();
 
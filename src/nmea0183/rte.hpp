@@ -48,10 +48,13 @@ class RTE : public RESPONSE
 
       void delete_all_entries( void );
 
-      double last_message_number_received;
+      int last_message_number_received; // 0 when not in the middle of a route
+      int last_total_number_of_messages;
 
       int last_waypoint_number_written;
 
+      ROUTE assembling; // Messages of the route received so far
+
    public:
 
       RTE();
@@ -60,10 +63,19 @@ class RTE : public RESPONSE
 
       ROUTE_TYPE TypeOfRoute;
       wxString    RouteName;
-      wxArrayString Waypoints;
+      ROUTE       Waypoints; // Of this message only
       int message_number;
       int total_number_of_messages;
 
+      /*
+      ** The last route received whole, from message 1 through
+      ** total_number_of_messages in order
+      */
+
+      ROUTE         Route;
+      unsigned long Routes;       // Routes completed
+      unsigned long BrokenRoutes; // Routes thrown away for a missing message
+
       virtual void Empty( void );
       virtual bool Parse( const SENTENCE& sentence );
       virtual bool Write( SENTENCE& sentence );
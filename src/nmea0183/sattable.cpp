@@ -0,0 +1,321 @@
+/***************************************************************************
+ *
+ * Project:  OpenCPN
+ * Purpose:  NMEA0183 Support Classes
+ * Author:   Sean D'Epagnier
+ *
+ ***************************************************************************
+ *   Copyright (C) 2018 by Sean D'Epagnier                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.             *
+ ***************************************************************************
+ */
+
+
+
+#include "nmea0183.h"
+
+/*
+** The source a talker's cycles are kept under, -1 for talkers that do
+** not send satellites
+*/
+
+static int source_of_talker( unsigned short talker_code )
+{
+   switch( talker_code )
+   {
+      case TALKER_CODE( 'G', 'P' ):
+         return( ConstellationGPS );
+
+      case TALKER_CODE( 'G', 'L' ):
+         return( ConstellationGLONASS );
+
+      case TALKER_CODE( 'G', 'A' ):
+         return( ConstellationGalileo );
+
+      case TALKER_CODE( 'G', 'B' ):
+      case TALKER_CODE( 'B', 'D' ):
+         return( ConstellationBeiDou );
+
+      case TALKER_CODE( 'G', 'Q' ):
+      case TALKER_CODE( 'Q', 'Z' ):
+         return( ConstellationQZSS );
+
+      case TALKER_CODE( 'G', 'I' ):
+         return( ConstellationNavIC );
+
+      case TALKER_CODE( 'G', 'N' ):
+         return( ConstellationUnknown );
+
+      default:
+         return( -1 );
+   }
+}
+
+/*
+** GN (mixed) talkers number satellites in NMEA 2.3 style ranges
+*/
+
+static CONSTELLATION constellation_of_prn( int prn )
+{
+   if ( prn >= 1 && prn <= 64 )
+   {
+      return( ConstellationGPS );
+   }
+
+   if ( prn >= 65 && prn <= 96 )
+   {
+      return( ConstellationGLONASS );
+   }
+
+   if ( prn >= 193 && prn <= 202 )
+   {
+      return( ConstellationQZSS );
+   }
+
+   return( ConstellationUnknown );
+}
+
+static inline bool satellite_less( const SATELLITE& left, const SATELLITE& right )
+{
+   if ( left.Constellation != right.Constellation )
+   {
+      return( left.Constellation < right.Constellation );
+   }
+
+   return( left.Info.SatNumber < right.Info.SatNumber );
+}
+
+SATELLITE_TABLE::SATELLITE_TABLE()
+{
+   Reset();
+}
+
+SATELLITE_TABLE::~SATELLITE_TABLE()
+{
+   Reset();
+}
+
+void SATELLITE_TABLE::Reset( void )
+{
+   for( int index = 0; index < ConstellationCount; index++ )
+   {
+      sources[ index ].NumberOfMessages = 0;
+      sources[ index ].NextMessage      = 0;
+      sources[ index ].NumberCollected  = 0;
+      sources[ index ].NumberPublished  = 0;
+   }
+
+   NumberOfSatellites = 0;
+   Cycles             = 0;
+   BrokenCycles       = 0;
+}
+
+bool SATELLITE_TABLE::Add( const GSV& gsv, unsigned short talker_code )
+{
+   int source_index = source_of_talker( talker_code );
+
+   if ( source_index < 0 )
+   {
+      return( false );
+   }
+
+   SOURCE& source = sources[ source_index ];
+
+   if ( gsv.NumberOfMessages < 1 || gsv.NumberOfMessages > 9 ||
+        gsv.MessageNumber < 1 || gsv.MessageNumber > gsv.NumberOfMessages )
+   {
+      if ( source.NextMessage != 0 )
+      {
+         BrokenCycles++;
+         source.NextMessage = 0;
+      }
+
+      return( false );
+   }
+
+   if ( gsv.MessageNumber == 1 )
+   {
+      if ( source.NextMessage != 0 )
+      {
+         BrokenCycles++;
+      }
+
+      source.NumberOfMessages = gsv.NumberOfMessages;
+      source.NumberCollected  = 0;
+   }
+   else if ( gsv.MessageNumber != source.NextMessage || gsv.NumberOfMessages != source.NumberOfMessages )
+   {
+      if ( source.NextMessage != 0 )
+      {
+         BrokenCycles++;
+         source.NextMessage = 0;
+      }
+
+      return( false );
+   }
+
+   /*
+   ** Only the last message of a cycle may hold fewer than 4 satellites
+   */
+
+   int satellites = gsv.SatsInView - 4 * ( gsv.MessageNumber - 1 );
+
+   if ( satellites > 4 )
+   {
+      satellites = 4;
+   }
+
+   for( int index = 0; index < satellites; index++ )
+   {
+      const SAT_INFO& info = gsv.SatInfo[ index ];
+
+      if ( info.SatNumber <= 0 || source.NumberCollected >= SATELLITES_PER_GSV_CYCLE )
+      {
+         continue;
+      }
+
+      SATELLITE& satellite = source.Collected[ source.NumberCollected++ ];
+
+      satellite.Constellation = ( source_index == ConstellationUnknown ) ?
+                                constellation_of_prn( info.SatNumber ) : (CONSTELLATION) source_index;
+      satellite.Info          = info;
+   }
+
+   if ( gsv.MessageNumber < gsv.NumberOfMessages )
+   {
+      source.NextMessage = gsv.MessageNumber + 1;
+      return( false );
+   }
+
+   source.NextMessage = 0;
+   publish( source );
+
+   return( true );
+}
+
+void SATELLITE_TABLE::publish( SOURCE& source )
+{
+   source.NumberPublished = source.NumberCollected;
+
+   for( int index = 0; index < source.NumberCollected; index++ )
+   {
+      source.Published[ index ] = source.Collected[ index ];
+   }
+
+   /*
+   ** Rebuild the whole table, it is small and this happens about once a
+   ** second per talker
+   */
+
+   NumberOfSatellites = 0;
+
+   for( int source_index = 0; source_index < ConstellationCount; source_index++ )
+   {
+      const SOURCE& from = sources[ source_index ];
+
+      for( int index = 0; index < from.NumberPublished && NumberOfSatellites < SATELLITE_TABLE_SIZE; index++ )
+      {
+         /*
+         ** Insertion sort on constellation and PRN
+         */
+
+         int position = NumberOfSatellites++;
+
+         while( position > 0 && satellite_less( from.Published[ index ], Satellite[ position - 1 ] ) )
+         {
+            Satellite[ position ] = Satellite[ position - 1 ];
+            position--;
+         }
+
+         Satellite[ position ] = from.Published[ index ];
+      }
+   }
+
+   Cycles++;
+}
+
+const SATELLITE *SATELLITE_TABLE::Find( CONSTELLATION constellation, int prn ) const
+{
+   int low  = 0;
+   int high = NumberOfSatellites;
+
+   SATELLITE key;
+   key.Constellation  = constellation;
+   key.Info.SatNumber = prn;
+
+   while( low < high )
+   {
+      int middle = ( low + high ) / 2;
+
+      if ( satellite_less( Satellite[ middle ], key ) )
+      {
+         low = middle + 1;
+      }
+      else
+      {
+         high = middle;
+      }
+   }
+
+   if ( low < NumberOfSatellites && Satellite[ low ].Constellation == constellation && Satellite[ low ].Info.SatNumber == prn )
+   {
+      return( &Satellite[ low ] );
+   }
+
+   return( (const SATELLITE *) NULL );
+}
+
+int SATELLITE_TABLE::SatellitesAbove( int signal_to_noise_ratio ) const
+{
+   int count = 0;
+
+   for( int index = 0; index < NumberOfSatellites; index++ )
+   {
+      if ( Satellite[ index ].Info.SignalToNoiseRatio >= signal_to_noise_ratio )
+      {
+         count++;
+      }
+   }
+
+   return( count );
+}
+
+double SATELLITE_TABLE::MeanSignalToNoiseRatio( void ) const
+{
+   /*
+   ** Satellites in view but not tracked have no SNR, they are left out
+   */
+
+   int count = 0;
+   int total = 0;
+
+   for( int index = 0; index < NumberOfSatellites; index++ )
+   {
+      if ( Satellite[ index ].Info.SignalToNoiseRatio > 0 )
+      {
+         total += Satellite[ index ].Info.SignalToNoiseRatio;
+         count++;
+      }
+   }
+
+   if ( count == 0 )
+   {
+      return( 0.0 );
+   }
+
+   return( (double) total / count );
+}
@@ -44,6 +44,38 @@
 SENTENCE::SENTENCE()
 {
    Sentence.Empty();
+   text = text_buffer;
+   text_length = 0;
+   text_is_sentence = true;
+   text_buffer[ 0 ] = 0x00;
+   tag_block = (const char *) NULL;
+   tag_block_length = 0;
+   fields_indexed = false;
+   oversized = false;
+   number_of_fields = 0;
+   checksum_field = -1;
+   checksum_verified = false;
+   checksum_bad = Unknown0183;
+   checksum_mode = ChecksumLenient;
+}
+
+SENTENCE::SENTENCE( const SENTENCE& source )
+{
+   text = text_buffer;
+   text_length = 0;
+   text_is_sentence = true;
+   text_buffer[ 0 ] = 0x00;
+   tag_block = (const char *) NULL;
+   tag_block_length = 0;
+   fields_indexed = false;
+   oversized = false;
+   number_of_fields = 0;
+   checksum_field = -1;
+   checksum_verified = false;
+   checksum_bad = Unknown0183;
+   checksum_mode = ChecksumLenient;
+
+   *this = source;
 }
 
 SENTENCE::~SENTENCE()
@@ -51,109 +83,374 @@ SENTENCE::~SENTENCE()
    Sentence.Empty();
 }
 
-NMEA0183_BOOLEAN SENTENCE::Boolean( int field_number ) const
+void SENTENCE::index_fields( void ) const
 {
-//   ASSERT_VALID( this );
+   /*
+   ** A wxString sentence is narrowed to ASCII once, anything outside
+   ** 7 bits can not be NMEA and is replaced so the checksum fails
+   */
+
+   if ( text_is_sentence )
+   {
+      int string_length = Sentence.Len();
+
+      if ( string_length > NMEA0183_MAX_SENTENCE_LENGTH + 1 )
+      {
+         string_length = NMEA0183_MAX_SENTENCE_LENGTH + 1;
+      }
 
-   wxString field_data;
+      for( int index = 0; index < string_length; index++ )
+      {
+         wxChar character = Sentence[ index ];
+
+         text_buffer[ index ] = ( character >= 0 && character < 0x80 ) ? (char) character : 0x7F;
+      }
+
+      text_buffer[ string_length ] = 0x00;
+      text        = text_buffer;
+      text_length = string_length;
+
+      tag_block        = (const char *) NULL;
+      tag_block_length = 0;
+   }
 
-   field_data = Field( field_number );
+   const char *line = text;
 
-   if ( field_data.StartsWith(_T("A")) )
+   /*
+   ** \s:source,c:time*hh\$GPHDT,... the tag block is set aside and the
+   ** fields are indexed from the '$' as usual
+   */
+
+   if ( text_length > 0 && text[ 0 ] == '\\' )
    {
-      return( NTrue );
+      int closing = 1;
+
+      while( closing < text_length && text[ closing ] != '\\' )
+      {
+         closing++;
+      }
+
+      if ( closing < text_length )
+      {
+         tag_block        = text + 1;
+         tag_block_length = closing - 1;
+         text            += closing + 1;
+         text_length     -= closing + 1;
+      }
    }
-   else if ( field_data.StartsWith(_T("V")) )
+
+   /*
+   ** One pass over the sentence, remembering where each field starts.
+   ** Fields are separated by ',' and the checksum field follows the '*',
+   ** the sentence ends at the first CR, LF or NUL.
+   */
+
+   int string_length = text_length;
+   int index         = 1; // Skip over the $ at the begining of the sentence
+
+   number_of_fields = 0;
+   checksum_field   = -1;
+   oversized        = false;
+
+   if ( string_length > 0xFFFE )
    {
-      return( NFalse );
+      string_length = 0xFFFE;
    }
-   else
+
+   field_offset[ number_of_fields++ ] = index;
+
+   while( index < string_length )
    {
-      return( Unknown0183 );
+      char character = text[ index ];
+
+      if ( character == CARRIAGE_RETURN || character == LINE_FEED || character == 0x00 )
+      {
+         break;
+      }
+
+      if ( character == ',' || character == '*' )
+      {
+         if ( number_of_fields == NMEA0183_MAX_FIELDS )
+         {
+            oversized = true; // only past the length limit
+            break;
+         }
+
+         if ( character == '*' && checksum_field < 0 )
+         {
+            checksum_field = number_of_fields;
+         }
+
+         field_offset[ number_of_fields++ ] = index + 1;
+      }
+
+      index++;
+   }
+
+   if ( index > string_length )
+   {
+      index = string_length; // Empty sentence
+   }
+
+   /*
+   ** Too long to be NMEA, and the '*' may not have been seen.  Refused
+   ** like a FRAMER overrun rather than parsed cut short.
+   */
+
+   if ( ( text - line ) + index > NMEA0183_MAX_SENTENCE_LENGTH )
+   {
+      oversized = true;
    }
+
+   field_offset[ number_of_fields ] = index + 1;
+
+   fields_indexed    = true;
+   checksum_verified = false;
 }
 
-COMMUNICATIONS_MODE SENTENCE::CommunicationsMode( int field_number ) const
+int SENTENCE::field_length( int field_number ) const
 {
-//   ASSERT_VALID( this );
+   if ( ! fields_indexed )
+   {
+      index_fields();
+   }
+
+   if ( field_number < 0 || field_number >= number_of_fields )
+   {
+      return( -1 );
+   }
+
+   return( field_offset[ field_number + 1 ] - field_offset[ field_number ] - 1 );
+}
+
+char SENTENCE::single_character( int field_number ) const
+{
+   /*
+   ** The one character flag fields (N/S, E/W, L/R...) must match exactly
+   */
+
+   if ( field_length( field_number ) != 1 )
+   {
+      return( 0 );
+   }
+
+   return( text[ field_offset[ field_number ] ] );
+}
 
-   wxString field_data;
+int SENTENCE::copy_field( int field_number, char *buffer, int buffer_size ) const
+{
+   /*
+   ** Copy a field into a caller supplied NUL terminated buffer, the
+   ** field itself is not terminated when text is the caller's buffer
+   */
 
-   field_data = Field( field_number );
+   int length = field_length( field_number );
 
-   if ( field_data == _T("d") )
+   if ( length < 0 )
    {
-      return( F3E_G3E_SimplexTelephone );
+      length = 0;
    }
-   else if ( field_data == _T("e") )
+
+   if ( length > buffer_size - 1 )
    {
-      return( F3E_G3E_DuplexTelephone );
+      length = buffer_size - 1;
    }
-   else if ( field_data == _T("m") )
+
+   if ( length > 0 )
+   {
+      ::memcpy( buffer, text + field_offset[ field_number ], length );
+   }
+
+   buffer[ length ] = 0x00;
+
+   return( length );
+}
+
+void SENTENCE::Assign( const char *data, int length )
+{
+   /*
+   ** Parse straight out of the caller's bytes, nothing is copied so they
+   ** must stay put until the next sentence is assigned
+   */
+
+   text             = data;
+   text_length      = ( data != NULL && length > 0 ) ? length : 0;
+   text_is_sentence = false;
+   tag_block        = (const char *) NULL;
+   tag_block_length = 0;
+
+   if ( text_length == 0 )
    {
-      return( J3E_Telephone );
+      text = "";
    }
-   else if ( field_data == _T("o") )
+
+   index_fields();
+}
+
+int SENTENCE::TagBlock( const char *& data ) const
+{
+   /*
+   ** What was between the '\' characters, -1 when there was no tag block
+   */
+
+   if ( ! fields_indexed )
    {
-      return( H3E_Telephone );
+      index_fields();
    }
-   else if ( field_data == _T("q") )
+
+   if ( tag_block == NULL )
    {
-      return( F1B_J2B_FEC_NBDP_TelexTeleprinter );
+      data = "";
+      return( -1 );
    }
-   else if ( field_data == _T("s") )
+
+   data = tag_block;
+
+   return( tag_block_length );
+}
+
+const char *SENTENCE::Data( void ) const
+{
+   if ( ! fields_indexed )
    {
-      return( F1B_J2B_ARQ_NBDP_TelexTeleprinter );
+      index_fields();
    }
-   else if ( field_data == _T("w") )
+
+   return( text );
+}
+
+int SENTENCE::Length( void ) const
+{
+   if ( ! fields_indexed )
    {
-      return( F1B_J2B_ReceiveOnlyTeleprinterDSC );
+      index_fields();
    }
-   else if ( field_data == _T("x") )
+
+   return( text_length );
+}
+
+NMEA0183_BOOLEAN SENTENCE::Boolean( int field_number ) const
+{
+//   ASSERT_VALID( this );
+
+   /*
+   ** Only the first character counts
+   */
+
+   char first_character = 0;
+
+   if ( field_length( field_number ) > 0 )
    {
-      return( A1A_MorseTapeRecorder );
+      first_character = text[ field_offset[ field_number ] ];
    }
-   else if ( field_data == _T("{") )
+
+   if ( first_character == 'A' )
    {
-      return( A1A_MorseKeyHeadset );
+      return( NTrue );
    }
-   else if ( field_data == _T("|") )
+   else if ( first_character == 'V' )
    {
-      return( F1C_F2C_F3C_FaxMachine );
+      return( NFalse );
    }
    else
    {
-      return( CommunicationsModeUnknown );
+      return( Unknown0183 );
+   }
+}
+
+COMMUNICATIONS_MODE SENTENCE::CommunicationsMode( int field_number ) const
+{
+//   ASSERT_VALID( this );
+
+   /*
+   ** The enumeration values are the characters themselves
+   */
+
+   switch( single_character( field_number ) )
+   {
+      case 'd':
+      case 'e':
+      case 'm':
+      case 'o':
+      case 'q':
+      case 's':
+      case 'w':
+      case 'x':
+      case '{':
+      case '|':
+
+         return( (COMMUNICATIONS_MODE) single_character( field_number ) );
+
+      default:
+
+         return( CommunicationsModeUnknown );
    }
 }
 
 unsigned char SENTENCE::ComputeChecksum( void ) const
 {
-   unsigned char checksum_value = 0;
+   if ( ! fields_indexed )
+   {
+      index_fields();
+   }
 
-   int string_length = Sentence.Length();
-   int index = 1; // Skip over the $ at the begining of the sentence
+   /*
+   ** Everything between the $ and the * (or the end of the sentence)
+   */
 
-   while( index < string_length    &&
-       Sentence[ index ] != '*' &&
-       Sentence[ index ] != CARRIAGE_RETURN &&
-       Sentence[ index ] != LINE_FEED )
+   int end = ( checksum_field > 0 ) ? field_offset[ checksum_field ] - 1 : field_offset[ number_of_fields ] - 1;
+
+   if ( end <= 1 )
    {
-       checksum_value ^= (char)Sentence[ index ];
-       index++;
+      return( 0 );
    }
 
-   return( checksum_value );
+   return( compute_checksum( text + 1, end - 1 ) );
 }
 
 double SENTENCE::Double( int field_number ) const
 {
  //  ASSERT_VALID( this );
-    wxCharBuffer abuf = Field( field_number).ToUTF8();
-    if( !abuf.data() )                            // badly formed sentence?
-        return (999.);
- 
-    return( ::atof( abuf.data() ));
+
+   /*
+   ** Empty (and malformed) fields come back as NAN, use the two argument
+   ** version to tell which
+   */
+
+   double value = NAN;
+
+   if ( Double( field_number, value ) != FieldValid )
+   {
+      return( NAN );
+   }
+
+   return( value );
+}
+
+NMEA0183_FIELD_STATUS SENTENCE::Double( int field_number, double& value ) const
+{
+   int length = field_length( field_number );
+
+   if ( length <= 0 )
+   {
+      value = 0.0;
+      return( FieldEmpty );
+   }
+
+   return( decode_double( text + field_offset[ field_number ], length, value ) );
+}
+
+NMEA0183_FIELD_STATUS SENTENCE::Coordinate( int field_number, int maximum_degrees, int& degrees_e7 ) const
+{
+   int length = field_length( field_number );
+
+   if ( length <= 0 )
+   {
+      degrees_e7 = 0;
+      return( FieldEmpty );
+   }
+
+   return( decode_coordinate( text + field_offset[ field_number ], length, maximum_degrees, degrees_e7 ) );
 }
 
 
@@ -161,15 +458,13 @@ EASTWEST SENTENCE::EastOrWest( int field_number ) const
 {
 //   ASSERT_VALID( this );
 
-   wxString field_data;
+   char field_data = single_character( field_number );
 
-   field_data = Field( field_number );
-
-   if ( field_data == _T("E") )
+   if ( field_data == 'E' )
    {
       return( East );
    }
-   else if ( field_data == _T("W") )
+   else if ( field_data == 'W' )
    {
       return( West );
    }
@@ -179,74 +474,109 @@ EASTWEST SENTENCE::EastOrWest( int field_number ) const
    }
 }
 
-const wxString& SENTENCE::Field( int desired_field_number ) const
+int SENTENCE::FieldData( int field_number, const char *& data ) const
+{
+   /*
+   ** The field's bytes in place, not NUL terminated.  Only good until the
+   ** sentence changes.
+   */
+
+   int length = field_length( field_number );
+
+   if ( length < 0 )
+   {
+      data = text;
+      return( 0 );
+   }
+
+   data = text + field_offset[ field_number ];
+
+   return( length );
+}
+
+wxString SENTENCE::Field( int desired_field_number ) const
 {
 //   ASSERT_VALID( this );
 
-   static wxString return_string;
-   return_string.Empty();
+   int length = field_length( desired_field_number );
 
-   int index                = 1; // Skip over the $ at the begining of the sentence
-   int current_field_number = 0;
-   int string_length        = 0;
+   if ( length < 0 )
+   {
+      return( wxString() );
+   }
 
-   string_length = Sentence.Len();
+   /*
+   ** The checksum field keeps its leading '*', callers use it to tell a
+   ** checksum from an optional trailing data field
+   */
 
-   while( current_field_number < desired_field_number && index < string_length )
+   if ( desired_field_number == checksum_field )
    {
-      if ( Sentence[ index ] == ',' || Sentence[ index ] == '*' )
-      {
-         current_field_number++;
-      }
+      return( wxString::FromAscii( text + field_offset[ desired_field_number ] - 1, length + 1 ) );
+   }
 
-      if( Sentence[ index ] == '*')
-          return_string += Sentence[ index ];
+   return( wxString::FromAscii( text + field_offset[ desired_field_number ], length ) );
+}
 
-      index++;
+void SENTENCE::Field( int desired_field_number, wxString& value ) const
+{
+   /*
+   ** Same as Field() but written over the caller's string, which keeps its
+   ** buffer from one sentence to the next instead of taking a new one
+   */
+
+   value.Empty();
+
+   int length = field_length( desired_field_number );
+
+   if ( length < 0 )
+   {
+      return;
+   }
+
+   const char *data = text + field_offset[ desired_field_number ];
+
+   if ( desired_field_number == checksum_field )
+   {
+      data--;
+      length++;
    }
 
-   if ( current_field_number == desired_field_number )
+   for( int index = 0; index < length; index++ )
    {
-      while( index < string_length    &&
-             Sentence[ index ] != ',' &&
-             Sentence[ index ] != '*' &&
-             Sentence[ index ] != 0x00 )
-      {
-         return_string += Sentence[ index ];
-         index++;
-      }
+      value += (wxChar) data[ index ];
    }
+}
 
+bool SENTENCE::IsOversized( void ) const
+{
+   if ( ! fields_indexed )
+   {
+      index_fields();
+   }
 
-   return( return_string );
+   return( oversized );
 }
 
 int SENTENCE::GetNumberOfDataFields( void ) const
 {
 //   ASSERT_VALID( this );
 
-   int index                = 1; // Skip over the $ at the begining of the sentence
-   int current_field_number = 0;
-   int string_length        = 0;
-
-   string_length = Sentence.Len();
-
-   while( index < string_length )
+   if ( ! fields_indexed )
    {
-      if ( Sentence[ index ] == '*' )
-      {
-         return( (int) current_field_number );
-      }
+      index_fields();
+   }
 
-      if ( Sentence[ index ] == ',' )
-      {
-         current_field_number++;
-      }
+   /*
+   ** Count of separators in front of the checksum
+   */
 
-      index++;
+   if ( checksum_field > 0 )
+   {
+      return( checksum_field - 1 );
    }
 
-   return( (int) current_field_number );
+   return( number_of_fields - 1 );
 }
 
 void SENTENCE::Finish( void )
@@ -259,17 +589,32 @@ void SENTENCE::Finish( void )
 
    temp_string.Printf(_T("*%02X%c%c"), (int) checksum, CARRIAGE_RETURN, LINE_FEED );
    Sentence += temp_string;
+   text_is_sentence = true;
+   fields_indexed = false;
 }
 
 int SENTENCE::Integer( int field_number ) const
 {
 //   ASSERT_VALID( this );
 
-    wxCharBuffer abuf = Field( field_number).ToUTF8();
-    if( !abuf.data() )                            // badly formed sentence?
-        return 0;
-    
-    return( ::atoi( abuf.data() ));
+   int value = 0;
+
+   Integer( field_number, value );
+
+   return( value );
+}
+
+NMEA0183_FIELD_STATUS SENTENCE::Integer( int field_number, int& value ) const
+{
+   int length = field_length( field_number );
+
+   if ( length <= 0 )
+   {
+      value = 0;
+      return( FieldEmpty );
+   }
+
+   return( decode_integer( text + field_offset[ field_number ], length, value ) );
 }
 
 NMEA0183_BOOLEAN SENTENCE::IsChecksumBad( int checksum_field_number ) const
@@ -277,38 +622,168 @@ NMEA0183_BOOLEAN SENTENCE::IsChecksumBad( int checksum_field_number ) const
 //   ASSERT_VALID( this );
 
    /*
-   ** Checksums are optional, return TRUE if an existing checksum is known to be bad
+   ** Checksums are optional, return TRUE if an existing checksum is known to be bad.
+   ** Newer versions of a sentence append fields, so the checksum is taken from
+   ** after the '*' rather than from checksum_field_number.
    */
 
-   wxString checksum_in_sentence = Field( checksum_field_number );
+   if ( ! fields_indexed )
+   {
+      index_fields();
+   }
 
-   if ( checksum_in_sentence == _T("") )
+   if ( checksum_mode == ChecksumOff )
    {
-      return( Unknown0183 );
+      return( NFalse );
    }
 
-   wxString check = checksum_in_sentence.Mid( 1 );
-   if ( ComputeChecksum() != HexValue( check ) )
+   if ( oversized )
    {
       return( NTrue );
    }
 
-   return( NFalse );
+   if ( checksum_field < 0 )
+   {
+      return( Unknown0183 );
+   }
+
+   if ( checksum_field != number_of_fields - 1 )
+   {
+      return( NTrue ); // more fields after the '*'
+   }
+
+   return( IsChecksumBad() );
 }
 
-LEFTRIGHT SENTENCE::LeftOrRight( int field_number ) const
+NMEA0183_BOOLEAN SENTENCE::IsChecksumBad( void ) const
 {
 //   ASSERT_VALID( this );
 
-   wxString field_data;
+   /*
+   ** Checks the field after the '*' wherever it is, Unknown0183 when the
+   ** sentence has no checksum.  Anything but exactly two hex digits is bad.
+   */
+
+   if ( ! fields_indexed )
+   {
+      index_fields();
+   }
+
+   if ( checksum_verified )
+   {
+      return( checksum_bad );
+   }
+
+   checksum_verified = true;
+   checksum_bad      = oversized ? NTrue : Unknown0183;
+
+   if ( oversized )
+   {
+      return( checksum_bad );
+   }
+
+   int length = field_length( checksum_field );
+
+   if ( length <= 0 )
+   {
+      return( checksum_bad );
+   }
+
+   const char *hex = text + field_offset[ checksum_field ];
+   int checksum_in_sentence = 0;
+
+   checksum_bad = NTrue;
+
+   if ( length != 2 )
+   {
+      return( checksum_bad );
+   }
+
+   for( int index = 0; index < 2; index++ )
+   {
+      char character = hex[ index ];
+      int  digit     = 0;
+
+      if ( character >= '0' && character <= '9' )
+      {
+         digit = character - '0';
+      }
+      else if ( character >= 'A' && character <= 'F' )
+      {
+         digit = character - 'A' + 10;
+      }
+      else if ( character >= 'a' && character <= 'f' )
+      {
+         digit = character - 'a' + 10;
+      }
+      else
+      {
+         return( checksum_bad );
+      }
+
+      checksum_in_sentence = checksum_in_sentence * 16 + digit;
+   }
+
+   if ( ComputeChecksum() == (unsigned char) checksum_in_sentence )
+   {
+      checksum_bad = NFalse;
+   }
+
+   return( checksum_bad );
+}
+
+NMEA0183_CHECKSUM_MODE SENTENCE::GetChecksumMode( void ) const
+{
+   return( checksum_mode );
+}
+
+void SENTENCE::SetChecksumMode( NMEA0183_CHECKSUM_MODE mode )
+{
+   checksum_mode = mode;
+}
+
+unsigned int SENTENCE::MnemonicKey( void ) const
+{
+   /*
+   ** The last three characters of the address field ($--HDT) packed into
+   ** an integer, or just 'P' for proprietary sentences ($PGRME)
+   */
+
+   int length = field_length( 0 );
+
+   if ( length < 1 )
+   {
+      return( 0 );
+   }
+
+   int start = field_offset[ 0 ];
+
+   if ( text[ start ] == 'P' )
+   {
+      return( 'P' );
+   }
+
+   if ( length < 3 )
+   {
+      return( 0 );
+   }
+
+   start += length - 3;
+
+   return( NMEA0183_MNEMONIC_KEY( text[ start ], text[ start + 1 ], text[ start + 2 ] ) );
+}
+
+LEFTRIGHT SENTENCE::LeftOrRight( int field_number ) const
+{
+//   ASSERT_VALID( this );
 
-   field_data = Field( field_number );
+   char field_data = single_character( field_number );
 
-   if ( field_data == _T("L") )
+   if ( field_data == 'L' )
    {
       return( Left );
    }
-   else if ( field_data == _T("R") )
+   else if ( field_data == 'R' )
    {
       return( Right );
    }
@@ -322,15 +797,13 @@ NORTHSOUTH SENTENCE::NorthOrSouth( int field_number ) const
 {
 //   ASSERT_VALID( this );
 
-   wxString field_data;
-
-   field_data = Field( field_number );
+   char field_data = single_character( field_number );
 
-   if ( field_data == _T("N") )
+   if ( field_data == 'N' )
    {
       return( North );
    }
-   else if ( field_data == _T("S") )
+   else if ( field_data == 'S' )
    {
       return( South );
    }
@@ -344,27 +817,25 @@ REFERENCE SENTENCE::Reference( int field_number ) const
 {
 //   ASSERT_VALID( this );
 
-   wxString field_data;
-
-   field_data = Field( field_number );
+   char field_data = single_character( field_number );
 
-   if ( field_data == _T("B") )
+   if ( field_data == 'B' )
    {
       return( BottomTrackingLog );
    }
-   else if ( field_data == _T("M") )
+   else if ( field_data == 'M' )
    {
       return( ManuallyEntered );
    }
-   else if ( field_data == _T("W") )
+   else if ( field_data == 'W' )
    {
       return( WaterReferenced );
    }
-   else if ( field_data == _T("R") )
+   else if ( field_data == 'R' )
    {
       return( RadarTrackingOfFixedTarget );
    }
-   else if ( field_data == _T("P") )
+   else if ( field_data == 'P' )
    {
       return( PositioningSystemGroundReference );
    }
@@ -378,53 +849,28 @@ TRANSDUCER_TYPE SENTENCE::TransducerType( int field_number ) const
 {
 //   ASSERT_VALID( this );
 
-   wxString field_data;
-
-   field_data = Field( field_number );
+   /*
+   ** The enumeration values are the characters themselves
+   */
 
-   if ( field_data == _T("A") )
-   {
-      return( AngularDisplacementTransducer );
-   }
-   else if ( field_data == _T("D") )
-   {
-      return( LinearDisplacementTransducer );
-   }
-   else if ( field_data == _T("C") )
-   {
-      return( TemperatureTransducer );
-   }
-   else if ( field_data == _T("F") )
+   switch( single_character( field_number ) )
    {
-      return( FrequencyTransducer );
-   }
-   else if ( field_data == _T("N") )
-   {
-      return( ForceTransducer );
-   }
-   else if ( field_data == _T("P") )
-   {
-      return( PressureTransducer );
-   }
-   else if ( field_data == _T("R") )
-   {
-      return( FlowRateTransducer );
-   }
-   else if ( field_data == _T("T") )
-   {
-      return( TachometerTransducer );
-   }
-   else if ( field_data == _T("H") )
-   {
-      return( HumidityTransducer );
-   }
-   else if ( field_data == _T("V") )
-   {
-      return( VolumeTransducer );
-   }
-   else
-   {
-      return( TransducerUnknown );
+      case 'A':
+      case 'D':
+      case 'C':
+      case 'F':
+      case 'N':
+      case 'P':
+      case 'R':
+      case 'T':
+      case 'H':
+      case 'V':
+
+         return( (TRANSDUCER_TYPE) single_character( field_number ) );
+
+      default:
+
+         return( TransducerUnknown );
    }
 }
 
@@ -436,6 +882,11 @@ SENTENCE::operator wxString() const
 {
 //   ASSERT_VALID( this );
 
+   if ( ! text_is_sentence )
+   {
+      return( wxString::FromAscii( text, text_length ) );
+   }
+
    return( Sentence );
 }
 
@@ -443,8 +894,26 @@ const SENTENCE& SENTENCE::operator = ( const SENTENCE& source )
 {
 //   ASSERT_VALID( this );
 
+   if ( this == &source )
+   {
+      return( *this );
+   }
+
    Sentence = source.Sentence;
 
+   if ( source.text_is_sentence )
+   {
+      text_is_sentence = true;
+      index_fields();
+   }
+   else
+   {
+      Assign( source.text, source.text_length );
+
+      tag_block        = source.tag_block;
+      tag_block_length = source.tag_block_length;
+   }
+
    return( *this );
 }
 
@@ -453,6 +922,8 @@ const SENTENCE& SENTENCE::operator = ( const wxString& source )
 //   ASSERT_VALID( this );
 
    Sentence = source;
+   text_is_sentence = true;
+   index_fields();
 
    return( *this );
 }
@@ -464,6 +935,9 @@ const SENTENCE& SENTENCE::operator += ( const wxString& source )
     Sentence += _T(",");
    Sentence += source;
 
+   text_is_sentence = true;
+   fields_indexed = false;
+
    return( *this );
 }
 
@@ -471,12 +945,23 @@ const SENTENCE& SENTENCE::operator += ( double value )
 {
 //   ASSERT_VALID( this );
 
-   wxString temp_string;
+   Sentence += _T(",");
 
-   temp_string.Printf(_T("%.3f"), value );
+   /*
+   ** NAN is what an empty field parsed to, write it back empty
+   */
 
-   Sentence += _T(",");
-   Sentence += temp_string;
+   if ( value == value )
+   {
+      wxString temp_string;
+
+      temp_string.Printf(_T("%.3f"), value );
+
+      Sentence += temp_string;
+   }
+
+   text_is_sentence = true;
+   fields_indexed = false;
 
    return( *this );
 }
@@ -544,6 +1029,9 @@ const SENTENCE& SENTENCE::operator += ( COMMUNICATIONS_MODE mode )
            break;
    }
 
+   text_is_sentence = true;
+   fields_indexed = false;
+
    return( *this );
 }
 
@@ -612,6 +1100,9 @@ const SENTENCE& SENTENCE::operator += ( TRANSDUCER_TYPE transducer )
 
    }
 
+   text_is_sentence = true;
+   fields_indexed = false;
+
    return( *this );
 }
 
@@ -630,6 +1121,9 @@ const SENTENCE& SENTENCE::operator += ( NORTHSOUTH northing )
        Sentence += _T("S");
    }
 
+   text_is_sentence = true;
+   fields_indexed = false;
+
    return( *this );
 }
 
@@ -644,6 +1138,9 @@ const SENTENCE& SENTENCE::operator += ( int value )
    Sentence += _T(",");
    Sentence += temp_string;
 
+   text_is_sentence = true;
+   fields_indexed = false;
+
    return( *this );
 }
 
@@ -662,6 +1159,30 @@ const SENTENCE& SENTENCE::operator += ( EASTWEST easting )
        Sentence += _T("W");
    }
 
+   text_is_sentence = true;
+   fields_indexed = false;
+
+   return( *this );
+}
+
+const SENTENCE& SENTENCE::operator += ( LEFTRIGHT left_or_right )
+{
+//   ASSERT_VALID( this );
+
+    Sentence += _T(",");
+
+   if ( left_or_right == Left )
+   {
+       Sentence += _T("L");
+   }
+   else if ( left_or_right == Right )
+   {
+       Sentence += _T("R");
+   }
+
+   text_is_sentence = true;
+   fields_indexed = false;
+
    return( *this );
 }
 
@@ -680,6 +1201,9 @@ const SENTENCE& SENTENCE::operator += ( NMEA0183_BOOLEAN boolean )
        Sentence += _T("V");
    }
 
+   text_is_sentence = true;
+   fields_indexed = false;
+
    return( *this );
 }
 
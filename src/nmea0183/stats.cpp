@@ -0,0 +1,151 @@
+/***************************************************************************
+ *
+ * Project:  OpenCPN
+ * Purpose:  NMEA0183 Support Classes
+ * Author:   Sean D'Epagnier
+ *
+ ***************************************************************************
+ *   Copyright (C) 2018 by Sean D'Epagnier                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.             *
+ ***************************************************************************
+ */
+
+
+#include "nmea0183.h"
+
+#include <chrono>
+
+/*
+** Bucket 0 holds parses under 64 ns, every bucket after that doubles
+*/
+
+#define FIRST_BUCKET_SHIFT 6
+
+PARSE_STATISTICS::PARSE_STATISTICS()
+{
+   TimingInterval = 0;
+   Reset();
+}
+
+PARSE_STATISTICS::~PARSE_STATISTICS()
+{
+}
+
+void PARSE_STATISTICS::Reset( void )
+{
+   ::memset( Sentence, 0, sizeof( Sentence ) );
+   NotSentences       = 0;
+   Oversized          = 0;
+   parses_until_timed = 0;
+}
+
+static void add_counts( SENTENCE_STATISTICS& total, const SENTENCE_STATISTICS& counts )
+{
+   total.Received         += counts.Received;
+   total.Parsed           += counts.Parsed;
+   total.ChecksumRejects  += counts.ChecksumRejects;
+   total.FieldErrors      += counts.FieldErrors;
+   total.Bytes            += counts.Bytes;
+   total.TimedParses      += counts.TimedParses;
+   total.TimedNanoseconds += counts.TimedNanoseconds;
+
+   for( int bucket = 0; bucket < NMEA0183_TIMING_BUCKETS; bucket++ )
+   {
+      total.ParseTime[ bucket ] += counts.ParseTime[ bucket ];
+   }
+}
+
+void PARSE_STATISTICS::Total( SENTENCE_STATISTICS& total ) const
+{
+   ::memset( &total, 0, sizeof( total ) );
+
+   for( int index = 0; index < SID_Count; index++ )
+   {
+      add_counts( total, Sentence[ index ] );
+   }
+}
+
+void PARSE_STATISTICS::Add( const PARSE_STATISTICS& other )
+{
+   /*
+   ** Counters kept apart, by several threads say, brought together
+   */
+
+   for( int index = 0; index < SID_Count; index++ )
+   {
+      add_counts( Sentence[ index ], other.Sentence[ index ] );
+   }
+
+   NotSentences += other.NotSentences;
+   Oversized    += other.Oversized;
+}
+
+bool PARSE_STATISTICS::StartTiming( void )
+{
+   if ( TimingInterval <= 0 )
+   {
+      return( false );
+   }
+
+   if ( parses_until_timed > 0 )
+   {
+      parses_until_timed--;
+      return( false );
+   }
+
+   parses_until_timed = TimingInterval - 1;
+
+   return( true );
+}
+
+void PARSE_STATISTICS::AddParseTime( SENTENCE_ID sentence_id, unsigned long long nanoseconds )
+{
+   SENTENCE_STATISTICS& counts = Sentence[ sentence_id ];
+
+   int bucket = 0;
+   unsigned long long scaled = nanoseconds >> FIRST_BUCKET_SHIFT;
+
+   while( scaled != 0 && bucket < NMEA0183_TIMING_BUCKETS - 1 )
+   {
+      scaled >>= 1;
+      bucket++;
+   }
+
+   counts.TimedParses++;
+   counts.TimedNanoseconds += nanoseconds;
+   counts.ParseTime[ bucket ]++;
+}
+
+unsigned long long PARSE_STATISTICS::Nanoseconds( void )
+{
+   return( (unsigned long long) std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now().time_since_epoch() ).count() );
+}
+
+unsigned long long PARSE_STATISTICS::BucketLimit( int bucket )
+{
+   /*
+   ** Parse times in the bucket are below this many nanoseconds, the last
+   ** bucket has no limit and returns 0
+   */
+
+   if ( bucket < 0 || bucket >= NMEA0183_TIMING_BUCKETS - 1 )
+   {
+      return( 0 );
+   }
+
+   return( 1ULL << ( bucket + FIRST_BUCKET_SHIFT ) );
+}
@@ -0,0 +1,247 @@
+/***************************************************************************
+ *
+ * Project:  OpenCPN
+ * Purpose:  NMEA0183 Support Classes
+ * Author:   Sean D'Epagnier
+ *
+ ***************************************************************************
+ *   Copyright (C) 2018 by Sean D'Epagnier                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.             *
+ ***************************************************************************
+ */
+
+
+#include "nmea0183.h"
+
+/*
+** c: is meant to be seconds, some gateways send milliseconds.  Nothing
+** past the year 5138 is expected in seconds.
+*/
+
+#define LARGEST_TIME_IN_SECONDS 1e11
+
+TAG_BLOCK::TAG_BLOCK()
+{
+   BadChecksums = 0;
+   Empty();
+}
+
+TAG_BLOCK::~TAG_BLOCK()
+{
+}
+
+void TAG_BLOCK::Empty( void )
+{
+   Present        = false;
+   Source[ 0 ]    = 0x00;
+   Time           = NAN;
+   TimeResolution = NAN;
+   LineCount      = -1;
+   GroupSentence  = 0;
+   GroupSentences = 0;
+   GroupID        = 0;
+}
+
+bool TAG_BLOCK::HasTime( void ) const
+{
+   return( Present && ! ::isnan( Time ) );
+}
+
+bool TAG_BLOCK::Parse( const SENTENCE& sentence )
+{
+   const char *data = NULL;
+   int length = sentence.TagBlock( data );
+
+   if ( length < 0 )
+   {
+      Empty();
+      return( false );
+   }
+
+   return( Parse( data, length ) );
+}
+
+static int hex_digit( char character )
+{
+   if ( character >= '0' && character <= '9' )
+   {
+      return( character - '0' );
+   }
+
+   if ( character >= 'A' && character <= 'F' )
+   {
+      return( character - 'A' + 10 );
+   }
+
+   if ( character >= 'a' && character <= 'f' )
+   {
+      return( character - 'a' + 10 );
+   }
+
+   return( -1 );
+}
+
+bool TAG_BLOCK::Parse( const char *data, int length )
+{
+   /*
+   ** data is what is between the two '\' characters
+   */
+
+   Empty();
+
+   if ( data == NULL || length <= 0 )
+   {
+      return( false );
+   }
+
+   int end = 0;
+
+   while( end < length && data[ end ] != '*' )
+   {
+      end++;
+   }
+
+   if ( end + 3 <= length )
+   {
+      int high = hex_digit( data[ end + 1 ] );
+      int low  = hex_digit( data[ end + 2 ] );
+
+      if ( high < 0 || low < 0 || compute_checksum( data, end ) != ( high << 4 ) + low )
+      {
+         BadChecksums++;
+         return( false );
+      }
+   }
+
+   int start = 0;
+
+   while( start < end )
+   {
+      int stop = start;
+
+      while( stop < end && data[ stop ] != ',' )
+      {
+         stop++;
+      }
+
+      /*
+      ** Every parameter is a letter, a colon and the value
+      */
+
+      if ( stop - start >= 2 && data[ start + 1 ] == ':' )
+      {
+         const char *value = data + start + 2;
+         int value_length  = stop - start - 2;
+
+         switch( data[ start ] )
+         {
+            case 's':
+            {
+               int copy = ( value_length < TAG_BLOCK_SOURCE_LENGTH ) ? value_length : TAG_BLOCK_SOURCE_LENGTH;
+
+               ::memcpy( Source, value, copy );
+               Source[ copy ] = 0x00;
+               break;
+            }
+
+            case 'c':
+
+               if ( decode_double( value, value_length, Time ) != FieldValid || Time < 0.0 )
+               {
+                  Time           = NAN;
+                  TimeResolution = NAN;
+                  break;
+               }
+
+               /*
+               ** Whole seconds unless decimals are sent, a count of
+               ** milliseconds is a thousand times finer
+               */
+
+               TimeResolution = 1.0;
+
+               {
+                  const char *point = (const char *) ::memchr( value, '.', value_length );
+
+                  if ( point != NULL )
+                  {
+                     for( int digits = value_length - (int) ( point - value ) - 1; digits > 0; digits-- )
+                     {
+                        TimeResolution /= 10.0;
+                     }
+                  }
+               }
+
+               if ( Time > LARGEST_TIME_IN_SECONDS )
+               {
+                  Time           /= 1000.0;
+                  TimeResolution /= 1000.0;
+               }
+
+               break;
+
+            case 'n':
+
+               if ( decode_integer( value, value_length, LineCount ) != FieldValid )
+               {
+                  LineCount = -1;
+               }
+
+               break;
+
+            case 'g':
+            {
+               /*
+               ** sentence-sentences-id
+               */
+
+               int numbers[ 3 ] = { 0, 0, 0 };
+               int number = 0;
+               int first  = 0;
+
+               for( int index = 0; index <= value_length && number < 3; index++ )
+               {
+                  if ( index == value_length || value[ index ] == '-' )
+                  {
+                     decode_integer( value + first, index - first, numbers[ number++ ] );
+                     first = index + 1;
+                  }
+               }
+
+               if ( number == 3 )
+               {
+                  GroupSentence  = numbers[ 0 ];
+                  GroupSentences = numbers[ 1 ];
+                  GroupID        = numbers[ 2 ];
+               }
+
+               break;
+            }
+
+            default:
+
+               break;
+         }
+      }
+
+      start = stop + 1;
+   }
+
+   Present = true;
+
+   return( true );
+}
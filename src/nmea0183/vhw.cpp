@@ -41,9 +41,24 @@
 
 //IMPLEMENT_DYNAMIC( VHW, RESPONSE )
 
+/*
+** Fields in sentence order
+*/
+
+typedef NMEA0183_SCHEMA<
+   NMEA0183_FIELD( VHW, DegreesTrue, 1 ),
+   NMEA0183_UNIT( 2, 'T' ),
+   NMEA0183_FIELD( VHW, DegreesMagnetic, 3 ),
+   NMEA0183_UNIT( 4, 'M' ),
+   NMEA0183_FIELD( VHW, Knots, 5 ),
+   NMEA0183_UNIT( 6, 'N' ),
+   NMEA0183_FIELD( VHW, KilometersPerHour, 7 ),
+   NMEA0183_UNIT( 8, 'K' ) > VHW_SCHEMA;
+
 VHW::VHW()
 {
    Mnemonic = _T("VHW");
+   SentenceID = SID_VHW;
    Empty();
 }
 
@@ -57,10 +72,7 @@ void VHW::Empty( void )
 {
 //   ASSERT_VALID( this );
 
-   DegreesTrue       = 0.0;
-   DegreesMagnetic   = 0.0;
-   Knots             = 0.0;
-   KilometersPerHour = 0.0;
+   VHW_SCHEMA::Empty( *this );
 }
 
 bool VHW::Parse( const SENTENCE& sentence )
@@ -90,16 +102,13 @@ bool VHW::Parse( const SENTENCE& sentence )
    ** First we check the checksum...
    */
 
-   if ( sentence.IsChecksumBad( 9 ) == TRUE )
+   if ( sentence.IsChecksumBad( VHW_SCHEMA::End ) == TRUE )
    {
       SetErrorMessage( _T("Invalid Checksum") );
       return( FALSE );
    } 
 
-   DegreesTrue       = sentence.Double( 1 );
-   DegreesMagnetic   = sentence.Double( 3 );
-   Knots             = sentence.Double( 5 );
-   KilometersPerHour = sentence.Double( 7 );
+   VHW_SCHEMA::Parse( sentence, *this );
 
    return( TRUE );
 }
@@ -114,28 +123,29 @@ bool VHW::Write( SENTENCE& sentence )
    
    RESPONSE::Write( sentence );
 
-   sentence += DegreesTrue;
-   sentence += _T("T");
-   sentence += DegreesMagnetic;
-   sentence += _T("M");
-   sentence += Knots;
-   sentence += _T("N");
-   sentence += KilometersPerHour;
-   sentence += _T("K");
+   VHW_SCHEMA::Write( sentence, *this );
 
    sentence.Finish();
 
    return( TRUE );
 }
 
+int VHW::Encode( char *buffer, int buffer_size, unsigned short talker_code )
+{
+   ENCODER encoder( buffer, buffer_size );
+
+   RESPONSE::Write( encoder, talker_code );
+
+   VHW_SCHEMA::Write( encoder, *this );
+
+   return( encoder.Finish() );
+}
+
 const VHW& VHW::operator = ( const VHW& source )
 {
 //   ASSERT_VALID( this );
 
-   DegreesTrue       = source.DegreesTrue;
-   DegreesMagnetic   = source.DegreesMagnetic;
-   Knots             = source.Knots;
-   KilometersPerHour = source.KilometersPerHour;
+   VHW_SCHEMA::Copy( *this, source );
 
    return( *this );
 }
@@ -40,9 +40,20 @@
 ** You can use it any way you like.
 */
 
+/*
+** Fields in sentence order
+*/
+
+typedef NMEA0183_SCHEMA<
+   NMEA0183_FIELD( VLW, TotalMileage, 1 ),
+   NMEA0183_UNIT( 2, 'N' ),
+   NMEA0183_FIELD( VLW, TripMileage, 3 ),
+   NMEA0183_UNIT( 4, 'N' ) > VLW_SCHEMA;
+
 VLW::VLW()
 {
    Mnemonic = _T("VLW");
+   SentenceID = SID_VLW;
    Empty();
 }
 
@@ -54,9 +65,8 @@ VLW::~VLW()
 
 void VLW::Empty( void )
 {
-   TotalMileage = 0.0;
-   TripMileage  = 0.0;
-   }
+   VLW_SCHEMA::Empty( *this );
+}
 
 bool VLW::Parse( const SENTENCE& sentence )
 {
@@ -80,14 +90,13 @@ bool VLW::Parse( const SENTENCE& sentence )
    ** First we check the checksum...
    */
 
-   if ( sentence.IsChecksumBad( 5 ) == TRUE )
+   if ( sentence.IsChecksumBad( VLW_SCHEMA::End ) == TRUE )
    {
       SetErrorMessage( _T("Invalid Checksum") );
       return( FALSE );
    }
 
-   TotalMileage = sentence.Double( 1 );
-   TripMileage  = sentence.Double( 3 );
+   VLW_SCHEMA::Parse( sentence, *this );
    
    return( TRUE );
 }
@@ -100,18 +109,25 @@ bool VLW::Write( SENTENCE& sentence )
 
    RESPONSE::Write( sentence );
 
-   sentence += TotalMileage;
-   sentence += _T("N");
-   sentence += TripMileage;
-   sentence += _T("N");
+   VLW_SCHEMA::Write( sentence, *this );
    sentence.Finish();
 
    return( TRUE );
 }
 
+int VLW::Encode( char *buffer, int buffer_size, unsigned short talker_code )
+{
+   ENCODER encoder( buffer, buffer_size );
+
+   RESPONSE::Write( encoder, talker_code );
+
+   VLW_SCHEMA::Write( encoder, *this );
+
+   return( encoder.Finish() );
+}
+
 const VLW& VLW::operator = ( const VLW& source )
 {
-   TotalMileage = source.TotalMileage;
-   TripMileage  = source.TripMileage;
+   VLW_SCHEMA::Copy( *this, source );
       return( *this );
 }
@@ -43,9 +43,24 @@
 
 //IMPLEMENT_DYNAMIC( VTG, RESPONSE )
 
+/*
+** Fields in sentence order
+*/
+
+typedef NMEA0183_SCHEMA<
+   NMEA0183_FIELD( VTG, TrackDegreesTrue, 1 ),
+   NMEA0183_UNIT( 2, 'T' ),
+   NMEA0183_FIELD( VTG, TrackDegreesMagnetic, 3 ),
+   NMEA0183_UNIT( 4, 'M' ),
+   NMEA0183_FIELD( VTG, SpeedKnots, 5 ),
+   NMEA0183_UNIT( 6, 'N' ),
+   NMEA0183_FIELD( VTG, SpeedKilometersPerHour, 7 ),
+   NMEA0183_UNIT( 8, 'K' ) > VTG_SCHEMA;
+
 VTG::VTG()
 {
    Mnemonic = _T("VTG");
+   SentenceID = SID_VTG;
    Empty();
 }
 
@@ -59,10 +74,7 @@ void VTG::Empty( void )
 {
 //   ASSERT_VALID( this );
 
-   TrackDegreesTrue       = 0.0;
-   TrackDegreesMagnetic   = 0.0;
-   SpeedKnots             = 0.0;
-   SpeedKilometersPerHour = 0.0;
+   VTG_SCHEMA::Empty( *this );
 }
 
 bool VTG::Parse( const SENTENCE& sentence )
@@ -92,48 +104,25 @@ bool VTG::Parse( const SENTENCE& sentence )
    ** First we check the checksum...
    */
 
-      int target_field_count = 8;
-
-      NMEA0183_BOOLEAN check = sentence.IsChecksumBad( 9 );
-
-      if ( check == NTrue )
-      {
-
-  /*
-      ** This may be an NMEA Version 2.3 sentence, with "Mode" field
-  */
-            wxString checksum_in_sentence = sentence.Field( 9 );
-            if(checksum_in_sentence.StartsWith(_T("*")))       // Field is a valid erroneous checksum
-            {
-                  SetErrorMessage( _T("Invalid Checksum") );
-                  return( FALSE );
-            }
-
-           else
-           {
-                  target_field_count = 9;
-                  check = sentence.IsChecksumBad( 10 );
-                  if( check == NTrue)
-                  {
-                        SetErrorMessage( _T("Invalid Checksum") );
-                        return( FALSE );
-                  }
-            }
-      }
+   if ( sentence.IsChecksumBad( VTG_SCHEMA::End ) == NTrue )
+   {
+      SetErrorMessage( _T("Invalid Checksum") );
+      return( FALSE );
+   }
 
+   /*
+   ** NMEA Version 2.3 sentences append a "Mode" field
+   */
 
+   int number_of_data_fields = sentence.GetNumberOfDataFields();
 
-   if ( sentence.GetNumberOfDataFields() != target_field_count )
+   if ( number_of_data_fields != 8 && number_of_data_fields != 9 )
    {
-         SetErrorMessage( _T("Invalid FieldCount") );
-         return( FALSE );
+      SetErrorMessage( _T("Invalid FieldCount") );
+      return( FALSE );
    }
 
-
-   TrackDegreesTrue       = sentence.Double( 1 );
-   TrackDegreesMagnetic   = sentence.Double( 3 );
-   SpeedKnots             = sentence.Double( 5 );
-   SpeedKilometersPerHour = sentence.Double( 7 );
+   VTG_SCHEMA::Parse( sentence, *this );
 
    return( TRUE );
 }
@@ -148,28 +137,29 @@ bool VTG::Write( SENTENCE& sentence )
 
    RESPONSE::Write( sentence );
 
-   sentence += TrackDegreesTrue;
-   sentence += _T("T");
-   sentence += TrackDegreesMagnetic;
-   sentence += _T("M");
-   sentence += SpeedKnots;
-   sentence += _T("N");
-   sentence += SpeedKilometersPerHour;
-   sentence += _T("K");
+   VTG_SCHEMA::Write( sentence, *this );
 
    sentence.Finish();
 
    return( TRUE );
 }
 
+int VTG::Encode( char *buffer, int buffer_size, unsigned short talker_code )
+{
+   ENCODER encoder( buffer, buffer_size );
+
+   RESPONSE::Write( encoder, talker_code );
+
+   VTG_SCHEMA::Write( encoder, *this );
+
+   return( encoder.Finish() );
+}
+
 const VTG& VTG::operator = ( const VTG& source )
 {
 //   ASSERT_VALID( this );
 
-   TrackDegreesTrue       = source.TrackDegreesTrue;
-   TrackDegreesMagnetic   = source.TrackDegreesMagnetic;
-   SpeedKnots             = source.SpeedKnots;
-   SpeedKilometersPerHour = source.SpeedKilometersPerHour;
+   VTG_SCHEMA::Copy( *this, source );
 
    return( *this );
 }
@@ -41,9 +41,24 @@
 
 //IMPLEMENT_DYNAMIC( MWV, RESPONSE )
 
+/*
+** Fields in sentence order
+*/
+
+typedef NMEA0183_SCHEMA<
+   NMEA0183_FIELD( VWR, WindDirectionMagnitude, 1 ),
+   NMEA0183_FIELD( VWR, DirectionOfWind, 2 ),
+   NMEA0183_FIELD( VWR, WindSpeedKnots, 3 ),
+   NMEA0183_UNIT( 4, 'N' ),
+   NMEA0183_FIELD( VWR, WindSpeedms, 5 ),
+   NMEA0183_UNIT( 6, 'M' ),
+   NMEA0183_FIELD( VWR, WindSpeedKmh, 7 ),
+   NMEA0183_UNIT( 8, 'K' ) > VWR_SCHEMA;
+
 VWR::VWR()
 {
    Mnemonic = _T("VWR");
+   SentenceID = SID_VWR;
    Empty();
 }
 
@@ -57,11 +72,7 @@ void VWR::Empty( void )
 {
 //   ASSERT_VALID( this );
 
-	WindDirectionMagnitude = 0.0;
-	DirectionOfWind = LR_Unknown;
-    WindSpeedKnots = 0.0;
-    WindSpeedms = 0.0;
-    WindSpeedKmh = 0.0;
+   VWR_SCHEMA::Empty( *this );
 }
 
 bool VWR::Parse( const SENTENCE& sentence )
@@ -90,17 +101,13 @@ bool VWR::Parse( const SENTENCE& sentence )
    ** First we check the checksum...
    */
 
-   if ( sentence.IsChecksumBad( 9 ) == TRUE )
+   if ( sentence.IsChecksumBad( VWR_SCHEMA::End ) == TRUE )
    {
       SetErrorMessage( _T("Invalid Checksum") );
       return( FALSE );
    } 
 
-   WindDirectionMagnitude = sentence.Double( 1 );
-   DirectionOfWind = sentence.LeftOrRight( 2 );
-   WindSpeedKnots = sentence.Double( 3 );
-   WindSpeedms = sentence.Double( 5 );
-   WindSpeedKmh = sentence.Double( 7 );
+   VWR_SCHEMA::Parse( sentence, *this );
 
    return( TRUE );
 }
@@ -115,25 +122,29 @@ bool VWR::Write( SENTENCE& sentence )
    
    RESPONSE::Write( sentence );
 
-   sentence += WindDirectionMagnitude;
-   sentence += DirectionOfWind;
-   sentence += WindSpeedKnots;
-   sentence += WindSpeedms;
-   sentence += WindSpeedms;
-   sentence += WindSpeedKmh;
+   VWR_SCHEMA::Write( sentence, *this );
+
+   sentence.Finish();
 
    return( TRUE );
 }
 
+int VWR::Encode( char *buffer, int buffer_size, unsigned short talker_code )
+{
+   ENCODER encoder( buffer, buffer_size );
+
+   RESPONSE::Write( encoder, talker_code );
+
+   VWR_SCHEMA::Write( encoder, *this );
+
+   return( encoder.Finish() );
+}
+
 const VWR& VWR::operator = ( const VWR& source )
 {
 //   ASSERT_VALID( this );
  
-   WindDirectionMagnitude   = source.WindDirectionMagnitude;
-   DirectionOfWind			= source.DirectionOfWind;
-   WindSpeedKnots			= source.WindSpeedKnots;
-   WindSpeedms				= source.WindSpeedms;
-   WindSpeedKmh				= source.WindSpeedKmh;
+   VWR_SCHEMA::Copy( *this, source );
 
    return( *this );
 }
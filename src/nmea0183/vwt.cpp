@@ -41,9 +41,24 @@
 
 //IMPLEMENT_DYNAMIC( MWV, RESPONSE )
 
+/*
+** Fields in sentence order
+*/
+
+typedef NMEA0183_SCHEMA<
+   NMEA0183_FIELD( VWT, WindDirectionMagnitude, 1 ),
+   NMEA0183_FIELD( VWT, DirectionOfWind, 2 ),
+   NMEA0183_FIELD( VWT, WindSpeedKnots, 3 ),
+   NMEA0183_UNIT( 4, 'N' ),
+   NMEA0183_FIELD( VWT, WindSpeedms, 5 ),
+   NMEA0183_UNIT( 6, 'M' ),
+   NMEA0183_FIELD( VWT, WindSpeedKmh, 7 ),
+   NMEA0183_UNIT( 8, 'K' ) > VWT_SCHEMA;
+
 VWT::VWT()
 {
    Mnemonic = _T("VWT");
+   SentenceID = SID_VWT;
    Empty();
 }
 
@@ -57,11 +72,7 @@ void VWT::Empty( void )
 {
 //   ASSERT_VALID( this );
 
-	WindDirectionMagnitude = 0.0;
-	DirectionOfWind = LR_Unknown;
-    WindSpeedKnots = 0.0;
-    WindSpeedms = 0.0;
-    WindSpeedKmh = 0.0;
+   VWT_SCHEMA::Empty( *this );
 }
 
 bool VWT::Parse( const SENTENCE& sentence )
@@ -90,17 +101,13 @@ bool VWT::Parse( const SENTENCE& sentence )
    ** First we check the checksum...
    */
 
-   if ( sentence.IsChecksumBad( 9 ) == TRUE )
+   if ( sentence.IsChecksumBad( VWT_SCHEMA::End ) == TRUE )
    {
       SetErrorMessage( _T("Invalid Checksum") );
       return( FALSE );
    } 
 
-   WindDirectionMagnitude = sentence.Double( 1 );
-   DirectionOfWind = sentence.LeftOrRight( 2 );
-   WindSpeedKnots = sentence.Double( 3 );
-   WindSpeedms = sentence.Double( 5 );
-   WindSpeedKmh = sentence.Double( 7 );
+   VWT_SCHEMA::Parse( sentence, *this );
 
    return( TRUE );
 }
@@ -115,25 +122,29 @@ bool VWT::Write( SENTENCE& sentence )
    
    RESPONSE::Write( sentence );
 
-   sentence += WindDirectionMagnitude;
-   sentence += DirectionOfWind;
-   sentence += WindSpeedKnots;
-   sentence += WindSpeedms;
-   sentence += WindSpeedms;
-   sentence += WindSpeedKmh;
+   VWT_SCHEMA::Write( sentence, *this );
+
+   sentence.Finish();
 
    return( TRUE );
 }
 
+int VWT::Encode( char *buffer, int buffer_size, unsigned short talker_code )
+{
+   ENCODER encoder( buffer, buffer_size );
+
+   RESPONSE::Write( encoder, talker_code );
+
+   VWT_SCHEMA::Write( encoder, *this );
+
+   return( encoder.Finish() );
+}
+
 const VWT& VWT::operator = ( const VWT& source )
 {
 //   ASSERT_VALID( this );
  
-   WindDirectionMagnitude   = source.WindDirectionMagnitude;
-   DirectionOfWind			= source.DirectionOfWind;
-   WindSpeedKnots			= source.WindSpeedKnots;
-   WindSpeedms				= source.WindSpeedms;
-   WindSpeedKmh				= source.WindSpeedKmh;
+   VWT_SCHEMA::Copy( *this, source );
 
    return( *this );
 }
@@ -42,9 +42,18 @@
 
 //IMPLEMENT_DYNAMIC( WPL, RESPONSE )
 
+/*
+** Fields in sentence order
+*/
+
+typedef NMEA0183_SCHEMA<
+   NMEA0183_FIELD( WPL, Position, 1 ),
+   NMEA0183_FIELD( WPL, To, 5 ) > WPL_SCHEMA;
+
 WPL::WPL()
 {
    Mnemonic = _T("WPL");
+   SentenceID = SID_WPL;
    Empty();
 }
 
@@ -56,9 +65,7 @@ WPL::~WPL()
 
 void WPL::Empty( void )
 {
-
-   Position.Empty();
-   To.Empty();
+   WPL_SCHEMA::Empty( *this );
 }
 
 bool WPL::Parse( const SENTENCE& sentence )
@@ -81,14 +88,13 @@ bool WPL::Parse( const SENTENCE& sentence )
    ** First we check the checksum...
    */
 
-   if ( sentence.IsChecksumBad( 6 ) == NTrue )
+   if ( sentence.IsChecksumBad( WPL_SCHEMA::End ) == NTrue )
    {
       SetErrorMessage( _T("Invalid Checksum") );
       return( FALSE );
    }
 
-   Position.Parse( 1, 2, 3, 4, sentence );
-   To = sentence.Field( 5 );
+   WPL_SCHEMA::Parse( sentence, *this );
 
    return( TRUE );
 }
@@ -101,19 +107,28 @@ bool WPL::Write( SENTENCE& sentence )
 
    RESPONSE::Write( sentence );
 
-   sentence += Position;
-   sentence += To;
+   WPL_SCHEMA::Write( sentence, *this );
 
    sentence.Finish();
 
    return( TRUE );
 }
 
+int WPL::Encode( char *buffer, int buffer_size, unsigned short talker_code )
+{
+   ENCODER encoder( buffer, buffer_size );
+
+   RESPONSE::Write( encoder, talker_code );
+
+   WPL_SCHEMA::Write( encoder, *this );
+
+   return( encoder.Finish() );
+}
+
 const WPL& WPL::operator = ( const WPL& source )
 {
 
-   Position = source.Position;
-   To       = source.To;
+   WPL_SCHEMA::Copy( *this, source );
 
    return( *this );
 }
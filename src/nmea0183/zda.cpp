@@ -41,9 +41,22 @@
 
 //IMPLEMENT_DYNAMIC( ZDA, RESPONSE )
 
+/*
+** Fields in sentence order
+*/
+
+typedef NMEA0183_SCHEMA<
+   NMEA0183_FIELD( ZDA, UTCTime, 1 ),
+   NMEA0183_FIELD( ZDA, Day, 2 ),
+   NMEA0183_FIELD( ZDA, Month, 3 ),
+   NMEA0183_FIELD( ZDA, Year, 4 ),
+   NMEA0183_FIELD( ZDA, LocalHourDeviation, 5 ),
+   NMEA0183_FIELD( ZDA, LocalMinutesDeviation, 6 ) > ZDA_SCHEMA;
+
 ZDA::ZDA()
 {
    Mnemonic = _T("ZDA");
+   SentenceID = SID_ZDA;
    Empty();
 }
 
@@ -57,12 +70,7 @@ void ZDA::Empty( void )
 {
 //   ASSERT_VALID( this );
 
-   UTCTime.Empty();
-   Day                   = 0;
-   Month                 = 0;
-   Year                  = 0;
-   LocalHourDeviation    = 0;
-   LocalMinutesDeviation = 0;
+   ZDA_SCHEMA::Empty( *this );
 }
 
 bool ZDA::Parse( const SENTENCE& sentence )
@@ -87,18 +95,13 @@ bool ZDA::Parse( const SENTENCE& sentence )
    ** First we check the checksum...
    */
 
-   if ( sentence.IsChecksumBad( 7 ) == TRUE )
+   if ( sentence.IsChecksumBad( ZDA_SCHEMA::End ) == TRUE )
    {
       SetErrorMessage( _T("Invalid Checksum") );
       return( FALSE );
    } 
 
-   UTCTime               = sentence.Field( 1 );
-   Day                   = sentence.Integer( 2 );
-   Month                 = sentence.Integer( 3 );
-   Year                  = sentence.Integer( 4 );
-   LocalHourDeviation    = sentence.Integer( 5 );
-   LocalMinutesDeviation = sentence.Integer( 6 );
+   ZDA_SCHEMA::Parse( sentence, *this );
 
    return( TRUE );
 }
@@ -113,28 +116,29 @@ bool ZDA::Write( SENTENCE& sentence )
    
    RESPONSE::Write( sentence );
 
-   sentence += UTCTime;
-   sentence += Day;
-   sentence += Month;
-   sentence += Year;
-   sentence += LocalHourDeviation;
-   sentence += LocalMinutesDeviation;
+   ZDA_SCHEMA::Write( sentence, *this );
 
    sentence.Finish();
 
    return( TRUE );
 }
 
+int ZDA::Encode( char *buffer, int buffer_size, unsigned short talker_code )
+{
+   ENCODER encoder( buffer, buffer_size );
+
+   RESPONSE::Write( encoder, talker_code );
+
+   ZDA_SCHEMA::Write( encoder, *this );
+
+   return( encoder.Finish() );
+}
+
 const ZDA& ZDA::operator = ( const ZDA& source )
 {
 //   ASSERT_VALID( this );
 
-   UTCTime               = source.UTCTime;
-   Day                   = source.Day;
-   Month                 = source.Month;
-   Year                  = source.Year;
-   LocalHourDeviation    = source.LocalHourDeviation;
-   LocalMinutesDeviation = source.LocalMinutesDeviation;
+   ZDA_SCHEMA::Copy( *this, source );
 
    return( *this );
 }
@@ -30,6 +30,7 @@
 #include "jsonwriter.h"
 
 #include "rotationctrl_pi.h"
+#include "NMEAThread.h"
 #include "PreferencesDialog.h"
 #include "icons.h"
 
@@ -42,6 +43,37 @@ static double heading_resolve(double degrees, double offset = 180)
     return degrees;
 }
 
+static double Seconds(const wxDateTime &time)
+{
+    return time.GetValue().ToDouble() / 1000.0;
+}
+
+// measurement variances for the heading estimator, degrees^2 and (degrees/s)^2
+#define COMPASS_VARIANCE 4.0
+#define RATE_OF_TURN_VARIANCE 0.25
+
+// closer than this to where it is going the chart is not turned at all,
+// less than SetCurrentViewPort takes for the user turning it by hand
+#define SETTLED_DEGREES 0.05
+
+// MaxSlewRate is the most the chart turns in one update, and a slew was
+// stepped by updates this far apart, so it stays that speed whatever the
+// animation frame rate
+#define SLEW_UPDATE_MSECS 50
+
+// the adaptive update period: the least turn worth an update, and the
+// weight of each sample in the estimate of input noise
+#define ADAPTIVE_STEP_DEGREES 1.0
+#define NOISE_GAIN 0.05
+
+// course over ground is noisier the slower the boat, with the gps speed
+// error of a few tenths of a knot turning into an angle
+static double CogVariance(double sog)
+{
+    double degrees = 2 + rad2deg(atan2(0.3, isnan(sog) ? 0 : fabs(sog)));
+    return degrees * degrees;
+}
+
 // the class factories, used to create and destroy instances of the PlugIn
 
 extern "C" DECL_EXP opencpn_plugin* create_pi(void *ppimgr)
@@ -67,9 +99,15 @@ rotationctrl_pi::rotationctrl_pi(void *ppimgr)
     initialize_images();
     m_vp.rotation = 0;
     m_declination = 0;
-    m_sog = m_cog = 0;
-    m_heading = m_truewind = 0;
-    m_route_heading = 0;
+    m_sog = 0;
+    m_rate_of_turn = 0;
+    m_tag_clock_offset = m_tag_time = m_tag_spacing = NAN;
+    m_bNMEAThread = false;
+    m_bHeadingKalman = false;
+    m_NMEAThread = NULL;
+    m_sentences_screened = 0;
+    m_target = m_noise_input = NAN;
+    m_turn_rate = m_input_variance = 0;
     Reset();
 }
 
@@ -126,12 +164,21 @@ int rotationctrl_pi::Init(void)
          _("Wind Up"), _T(""), NULL, TOOL_POSITION, 0, this);
 
     LoadConfig(); //    And load the configuration items
-    m_bSlewRefresh = false;
     m_LimitRotation = m_LimitFilter = false;
 
     m_Timer.Connect(wxEVT_TIMER, wxTimerEventHandler
                     ( rotationctrl_pi::OnTimer ), NULL, this);
 
+    if(m_bNMEAThread) {
+        m_NMEAThread = new NMEAThread(*this, m_NMEA0183.GetChecksumMode(),
+                                      m_NMEA0183.Statistics.TimingInterval);
+        if(m_NMEAThread->Create() != wxTHREAD_NO_ERROR ||
+           m_NMEAThread->Run() != wxTHREAD_NO_ERROR) {
+            delete m_NMEAThread; // fall back to parsing on the gui thread
+            m_NMEAThread = NULL;
+        }
+    }
+
     return (WANTS_TOOLBAR_CALLBACK |
             WANTS_PREFERENCES      |
             WANTS_ONPAINT_VIEWPORT |
@@ -146,6 +193,12 @@ bool rotationctrl_pi::DeInit(void)
 {
     SaveConfig();
 
+    if(m_NMEAThread) {
+        m_NMEAThread->Delete();
+        delete m_NMEAThread;
+        m_NMEAThread = NULL;
+    }
+
     for(int i=0; i<NUM_ROTATION_TOOLS; i++)
         RemovePlugInTool(m_leftclick_tool_ids[i]);
 
@@ -206,14 +259,24 @@ void rotationctrl_pi::OnToolbarToolCallback(int id)
 {
     for(int i=0; i<NUM_ROTATION_TOOLS; i++)
         if(m_leftclick_tool_ids[i] == id) {
-            m_LimitRotation = false; // initially rotate fully
-            m_LimitFilter = false; // reset filter
+            {
+                wxCriticalSectionLocker lock(m_nmea_lock);
+                m_LimitRotation = false; // initially rotate fully
+                m_LimitFilter = false; // reset filter
+                m_heading_kalman.Reset(); // and start the estimates over
+                m_cog_kalman.Reset();
+                m_noise_input = NAN; // and what the update period adapts to
+                m_input_variance = m_turn_rate = 0;
+                m_target_time = wxDateTime();
+            }
             switch(i) {
             case NORTH_UP:
+                CancelUpdate();
                 SetCanvasRotation(0);
                 m_currenttool = 0;
                 break;
             case SOUTH_UP:
+                CancelUpdate();
                 SetCanvasRotation(M_PI);
                 m_currenttool = 0;
                 break;
@@ -224,12 +287,12 @@ void rotationctrl_pi::OnToolbarToolCallback(int id)
                 if(m_currenttool == i) {
                     m_currenttool = 0;
                     SetToolbarItemState( id, false );
-                    m_Timer.Stop();
+                    CancelUpdate();
                 } else {
                     Reset();
                     SetToolbarItemState( id, true );
                     m_currenttool = i;
-                    m_Timer.Start(1, true); // start right away
+                    ScheduleUpdate(1); // start right away
                 }
                 break;
             }
@@ -258,7 +321,7 @@ void rotationctrl_pi::OnToolbarToolDownCallback(int id)
             }
         }
 
-    m_last_rotation_time = wxDateTime::UNow();
+    m_last_rotation_time = Clock();
     RequestRefresh(GetOCPNCanvasWindow());
 }
 
@@ -270,19 +333,119 @@ void rotationctrl_pi::OnToolbarToolUpCallback(int id)
 
 void rotationctrl_pi::OnTimer( wxTimerEvent & )
 {
-//    double dt = m_lastfix.FixTime - m_lasttimerfix.FixTime;
+    TimerElapsed();
+}
 
-    m_cog = FilterAngle(m_lastfix.Cog, m_cog, m_currenttool == COURSE_UP);
-    m_sog = FilterSpeed(m_lastfix.Sog, m_sog);
-    
-//    m_lasttimerfix = m_lastfix;
+// the one timer runs both the updates and the animation frames
+void rotationctrl_pi::TimerElapsed()
+{
+    if(m_update_due.IsValid() && m_update_due <= Clock())
+        UpdateRotation();
+
+    wxDateTime now = Clock();
+    if(m_frame_due.IsValid() && m_frame_due <= now)
+        AnimationFrame(now);
+
+    ArmTimer();
+}
+
+// for whichever of the next update and the next frame is first
+void rotationctrl_pi::ArmTimer()
+{
+    wxDateTime due = m_update_due;
+    if(m_frame_due.IsValid() && (!due.IsValid() || m_frame_due < due))
+        due = m_frame_due;
+
+    if(!due.IsValid()) {
+        StopTimer();
+        return;
+    }
+
+    long msecs = (due - Clock()).GetMilliseconds().ToLong();
+    StartTimer(wxMax(msecs, 1L));
+}
+
+// one-shot, whatever was pending is replaced
+void rotationctrl_pi::StartTimer(int msecs)
+{
+    m_Timer.Start(msecs, true);
+}
+
+void rotationctrl_pi::StopTimer()
+{
+    m_Timer.Stop();
+}
 
-    double rotation = 0;
-    switch(m_currenttool) {
-    case COURSE_UP:   rotation = -m_cog;  break;
-    case HEADING_UP:  rotation = -m_heading; break;
-    case ROUTE_UP:
+// an update at most msecs from now, one already due sooner covers it
+void rotationctrl_pi::ScheduleUpdate(int msecs)
+{
+    wxDateTime due = Clock() + wxTimeSpan::Milliseconds(msecs);
+    if(m_update_due.IsValid() && m_update_due <= due)
+        return;
+
+    m_update_due = due;
+    ArmTimer();
+}
+
+// the tool is off or the chart was turned by hand: stop updating and turning
+void rotationctrl_pi::CancelUpdate()
+{
+    m_update_due = m_frame_due = wxDateTime();
+    StopTimer();
+}
+
+// the filters have new output: update no sooner than the update
+// period after the last one, so bursts of input cost one update
+void rotationctrl_pi::InputUpdated()
+{
+    if(!m_currenttool)
+        return;
+
+    long wait = 0;
+    if(m_last_update.IsValid())
+        wait = m_update_msecs - (Clock() - m_last_update).GetMilliseconds().ToLong();
+    ScheduleUpdate(wxMax(wait, 1L));
+}
+
+void rotationctrl_pi::UpdateRotation()
+{
+    // the last fix is held between updates, however far apart
+    wxDateTime now = Clock();
+    m_update_due = wxDateTime();
+    m_last_update = now;
+
+    // copy out what the nmea thread feeds under the lock, and release it
+    // before calling into OpenCPN so the thread never waits on the chart
+    double rotation = NAN, measured_rate, input_variance;
+    double lat, lon;
+    bool filtered;
     {
+        wxCriticalSectionLocker lock(m_nmea_lock);
+
+        double gain = FilterGain(m_cog_time, now);
+        if(!m_bHeadingKalman) // which takes each fix as it comes
+            FilterAngle(m_cog_filter, m_lastfix.Cog, gain, m_currenttool == COURSE_UP);
+        m_sog = FilterSpeed(m_lastfix.Sog, m_sog, gain);
+        lat = m_lastfix.Lat;
+        lon = m_lastfix.Lon;
+
+        switch(m_currenttool) {
+        case COURSE_UP:
+            rotation = -(m_bHeadingKalman ? m_cog_kalman.Angle(Seconds(now)) : m_cog_filter.Angle());
+            break;
+        case HEADING_UP:
+            rotation = -(m_bHeadingKalman ? m_heading_kalman.Angle(Seconds(now)) :
+                         m_heading_filter.Angle() + HeadingTurn(now));
+            break;
+        case WIND_UP:     rotation = -m_truewind_filter.Angle(); break;
+        }
+
+        measured_rate = MeasuredTurnRate(now);
+        input_variance = m_input_variance;
+        filtered = m_LimitFilter;
+    }
+
+    if(m_currenttool == ROUTE_UP) {
         double lastlat = m_routewaypoint.m_lat;
         double lastlon = m_routewaypoint.m_lon;
         if(GetSingleWaypoint( m_routeguid, &m_routewaypoint )) {
@@ -293,55 +456,105 @@ void rotationctrl_pi::OnTimer( wxTimerEvent & )
             double route_heading;
             DistanceBearingMercator_Plugin
                 (m_routewaypoint.m_lat, m_routewaypoint.m_lon,
-                 m_lastfix.Lat, m_lastfix.Lon,
+                 lat, lon,
                  &route_heading, NULL);
 
-            route_heading = route_heading;
-            
-            if(isnan(m_route_heading))
-                m_route_heading = route_heading;
-
-            m_route_heading = FilterAngle(route_heading, m_route_heading);
+            wxCriticalSectionLocker lock(m_nmea_lock); // for m_LimitFilter
+            FilterAngle(m_route_filter, route_heading,
+                        FilterGain(m_route_heading_time, now));
+            filtered = m_LimitFilter;
         }
 
-        rotation = -m_route_heading;
-    } break;
-    case WIND_UP:     rotation = -m_truewind; break;
-    default: return;
+        rotation = -m_route_filter.Angle();
     }
 
-    rotation += m_rotation_offset;
-
-    // limit rotation to slew rate
-    double crotation = rad2deg(m_vp.rotation);
-    double dr = heading_resolve(rotation - crotation, 0);
-    double max_rotation = m_max_slew_rate;
-    if(m_LimitRotation) {
-        if(dr > max_rotation) {
-            dr = max_rotation;
-            m_bSlewRefresh = true;
-        } else if(dr < -max_rotation) {
-            dr = -max_rotation;
-            m_bSlewRefresh = true;
-        }
-    } else if(m_LimitFilter)
-        m_LimitRotation = true;
+    if(isnan(rotation)) // no tool, or nothing received for it yet
+        return;
+
+    AdaptPeriod(rotation, measured_rate, input_variance, now);
 
-    m_Timer.Start(m_filter_msecs, true);
-    if(m_LimitFilter) // wait until the initial unfiltered value is ready
+    rotation = heading_resolve(rotation + m_rotation_offset);
+
+    if(!filtered) // wait until the initial unfiltered value is ready
         return;
-    
-    double min_rotation = 1;
-    if(fabs(dr) < min_rotation)
+
+    if(!m_LimitRotation) { // turn to the first value at once, then filter
+        {
+            wxCriticalSectionLocker lock(m_nmea_lock); // the filters read it
+            m_LimitRotation = true;
+        }
+        m_frame_due = wxDateTime();
+        m_vp.rotation = deg2rad(rotation);
+        SetCanvasRotation(m_vp.rotation);
         return;
-    
-    m_vp.rotation = heading_resolve(crotation + dr);
-    //printf("rotation %f %f\n", m_vp.rotation, dr);
-    m_vp.rotation = deg2rad(m_vp.rotation);
+    }
 
-    if(isnan(m_vp.rotation))
+    AnimateTo(rotation, now);
+}
+
+// where the chart is in its turn, and how fast it is turning (degrees per
+// second); true once it has arrived
+bool rotationctrl_pi::AnimationAt(const wxDateTime &now, double &angle, double &rate)
+{
+    double T = m_animation_seconds, v0 = m_animation_rate;
+    double u = (now - m_animation_start).GetMilliseconds().ToLong() / 1000.0 / T;
+    if(u >= 1) {
+        angle = m_animation_from + m_animation_delta;
+        rate = 0;
+        return true;
+    }
+    if(u < 0)
+        u = 0;
+
+    // cubic hermite from the starting rate to rest at the target, which is
+    // smoothstep's ease in and out when starting from rest
+    angle = m_animation_from + (u*u*u - 2*u*u + u) * T * v0 + (3 - 2*u) * u*u * m_animation_delta;
+    rate = (3*u*u - 4*u + 1) * v0 + 6*u*(1 - u) * m_animation_delta / T;
+    return false;
+}
+
+// start easing the chart toward target degrees.  A new target part way
+// through carries on at the rate the chart is already turning, so it
+// bends the motion rather than jolting it
+void rotationctrl_pi::AnimateTo(double target, const wxDateTime &now)
+{
+    double angle = rad2deg(m_vp.rotation), rate = 0;
+    if(m_frame_due.IsValid()) {
+        if(fabs(heading_resolve(m_animation_from + m_animation_delta - target, 0)) < SETTLED_DEGREES)
+            return; // already on the way there
+        AnimationAt(now, angle, rate);
+    }
+
+    double delta = heading_resolve(target - angle, 0);
+    if(fabs(delta) < SETTLED_DEGREES && rate == 0)
         return;
 
+    // the turn takes up to an update period, longer if its peak rate (1.5
+    // times the mean) would pass the slew limit
+    double seconds = wxMin(m_update_msecs / 1000.0, 1.0);
+    if(m_max_slew_rate > 0)
+        seconds = wxMax(seconds, 1.5 * fabs(delta) * SLEW_UPDATE_MSECS / (m_max_slew_rate * 1000));
+
+    m_animation_from = angle;
+    m_animation_delta = delta;
+    m_animation_rate = rate;
+    m_animation_seconds = seconds;
+    m_animation_start = now;
+
+    if(!m_frame_due.IsValid())
+        m_frame_due = now + wxTimeSpan::Milliseconds((long)(1000 / m_animation_fps));
+}
+
+// one frame of the turn, paced at m_animation_fps until it settles
+void rotationctrl_pi::AnimationFrame(const wxDateTime &now)
+{
+    double angle, rate;
+    if(AnimationAt(now, angle, rate))
+        m_frame_due = wxDateTime(); // arrived, nothing more to draw
+    else
+        m_frame_due = now + wxTimeSpan::Milliseconds((long)(1000 / m_animation_fps));
+
+    m_vp.rotation = deg2rad(heading_resolve(angle));
     SetCanvasRotation(m_vp.rotation);
 }
 
@@ -375,12 +588,42 @@ bool rotationctrl_pi::LoadConfig(void)
     }
 
     m_filter_msecs = 1000.0 * filter_seconds;
-    m_filter_lp = 1.0 / pConf->Read( _T ( "FilterSeconds" ), 10.0);
+
+    // while turning updates come as often as this, UpdateRate when steady
+    double min_seconds = pConf->ReadDouble( _T ( "MinUpdateRate" ), 0.25);
+    m_min_update_msecs = wxMax(50, wxMin((int)(1000 * min_seconds), m_filter_msecs));
+    m_update_msecs = m_filter_msecs;
+    m_filter_seconds = pConf->ReadDouble( _T ( "FilterSeconds" ), 10.0);
+
+    // 1 replaces the low pass for heading and course up by a kalman filter
+    // on heading and rate of turn, tuned by FilterSeconds as well
+    m_bHeadingKalman = pConf->Read( _T ( "HeadingKalman" ), 0L);
+    double process_noise = m_filter_seconds > 0 ? 1 / (m_filter_seconds * m_filter_seconds) : 1e6;
+    {
+        wxCriticalSectionLocker lock(m_nmea_lock);
+        m_heading_kalman.ProcessNoise = m_cog_kalman.ProcessNoise = process_noise;
+    }
     
     m_max_slew_rate = 20;
     m_max_slew_rate = pConf->ReadDouble("MaxSlewRate", 20.0);
     m_rotation_offset = pConf->Read( _T ( "RotationOffset" ), 0L);
-    
+
+    // frames per second while the chart turns between updates
+    m_animation_fps = pConf->ReadDouble( _T ( "AnimationRate" ), 20.0);
+    m_animation_fps = wxMax(1.0, wxMin(m_animation_fps, 60.0));
+
+    // 0 lenient (reject bad checksums), 1 strict (also reject missing), 2 off
+    long checksum_mode = pConf->Read( _T ( "ChecksumMode" ), (long)ChecksumLenient);
+    if(checksum_mode < ChecksumLenient || checksum_mode > ChecksumOff)
+        checksum_mode = ChecksumLenient;
+    m_NMEA0183.SetChecksumMode((NMEA0183_CHECKSUM_MODE)checksum_mode);
+
+    // time one parse in this many for the statistics, 0 never
+    m_NMEA0183.Statistics.TimingInterval = pConf->Read( _T ( "NMEATimingInterval" ), 0L);
+
+    // takes effect when the plugin is next initialized
+    m_bNMEAThread = pConf->Read( _T ( "NMEAThread" ), 0L);
+
     return true;
 }
 
@@ -398,17 +641,11 @@ bool rotationctrl_pi::SaveConfig(void)
 
 void rotationctrl_pi::SetCurrentViewPort(PlugIn_ViewPort &vp)
 {
-    // if we are slowed down due to slew rate refresh
-    if(m_bSlewRefresh) {
-        m_bSlewRefresh = false;
-        m_Timer.Start(50, true);
-    }
-
-    if(fabs(heading_resolve(rad2deg(m_vp.rotation - vp.rotation))) > .1) {
+    if(fabs(heading_resolve(rad2deg(m_vp.rotation - vp.rotation), 0)) > .1) {
         for(int i=0; i<NUM_ROTATION_TOOLS; i++)
             SetToolbarItemState( m_leftclick_tool_ids[i], false );
 
-        m_Timer.Stop();
+        CancelUpdate();
         m_currenttool = 0;
     }
 
@@ -417,7 +654,7 @@ void rotationctrl_pi::SetCurrentViewPort(PlugIn_ViewPort &vp)
     if(!m_rotation_dir && !m_tilt_dir)
         return;
 
-    wxDateTime now = wxDateTime::UNow();
+    wxDateTime now = Clock();
     long dt = 0;
     if(m_last_rotation_time.IsValid())
         dt = (now - m_last_rotation_time).GetMilliseconds().ToLong();
@@ -435,40 +672,123 @@ void rotationctrl_pi::SetCurrentViewPort(PlugIn_ViewPort &vp)
     RequestRefresh(GetOCPNCanvasWindow());
 }
 
+// bit per SENTENCE_ID (SID_Count < 32) of the sentences a tool listens to
+unsigned int rotationctrl_pi::SubscribedSentences( int tool )
+{
+    switch(tool) {
+    case HEADING_UP: return (1u << SID_HDT) | (1u << SID_HDM) | (1u << SID_ROT);
+    case WIND_UP:    return (1u << SID_MWV);
+    default:         return 0; // course and route up only need position fixes
+    }
+}
+
 void rotationctrl_pi::SetNMEASentence( wxString &sentence )
 {
-    if(!m_currenttool)
+    unsigned int subscribed = SubscribedSentences(m_currenttool);
+    if(!subscribed) {
+        m_sentences_screened++;
         return;
+    }
 
-    m_NMEA0183 << sentence;
+    // screen on the mnemonic ($--HDT) before anything is copied or converted,
+    // looking past a \s:src,c:time*hh\ tag block
+    size_t start = 0;
+    if(sentence.Len() && sentence[0] == '\\') {
+        start = 1;
+        while(start < sentence.Len() && sentence[start] != '\\')
+            start++;
+        start++;
+    }
+
+    if(sentence.Len() < start + 6 || sentence[start] != '$') {
+        m_sentences_screened++;
+        return;
+    }
 
-    if( !m_NMEA0183.PreParse() )
+    unsigned int key = NMEA0183_MNEMONIC_KEY((wxChar)sentence[start+3], (wxChar)sentence[start+4],
+                                             (wxChar)sentence[start+5]);
+    if(!(subscribed & (1u << m_NMEA0183.Identify(key)))) {
+        m_sentences_screened++;
         return;
+    }
 
-    if( m_currenttool == HEADING_UP && m_NMEA0183.LastSentenceIDReceived == _T("HDT") ) {
-        if( m_NMEA0183.Parse() ) {
-            if( !wxIsNaN(m_NMEA0183.Hdt.DegreesTrue) )
-                m_heading = FilterAngle(m_NMEA0183.Hdt.DegreesTrue, m_heading);
+    if(m_currenttool == HEADING_UP)
+        Declination(); // keep the cached value fresh, only possible from this thread
+
+    if(m_NMEAThread) {
+        m_NMEAThread->Enqueue(sentence, m_currenttool);
+        return;
+    }
+
+    m_NMEA0183 << sentence;
+    if(ProcessNMEA(m_NMEA0183, m_currenttool))
+        InputUpdated();
+}
+
+// called on the gui thread, or on the nmea thread with its own parser,
+// true if a filter took new input
+bool rotationctrl_pi::ProcessNMEA( NMEA0183 &nmea, int tool )
+{
+    if( !nmea.PreParse() )
+        return false;
+
+    bool updated = false;
+
+    if( tool == HEADING_UP && nmea.LastSentenceReceived == SID_HDT ) {
+        if( nmea.Parse() ) {
+            wxCriticalSectionLocker lock(m_nmea_lock);
+            if( !wxIsNaN(nmea.Hdt.DegreesTrue) ) {
+                wxDateTime now = SampleTime(nmea);
+                InputNoise(nmea.Hdt.DegreesTrue);
+                if(m_bHeadingKalman)
+                    EstimateHeading(m_heading_kalman, now, nmea.Hdt.DegreesTrue, COMPASS_VARIANCE);
+                else {
+                    m_heading_filter.Rotate(HeadingTurn(now));
+                    FilterAngle(m_heading_filter, nmea.Hdt.DegreesTrue, FilterGain(m_heading_time, now));
+                }
+                updated = true;
+            }
+        }
+    } else if( tool == HEADING_UP && nmea.LastSentenceReceived == SID_HDM ) {
+        if( nmea.Parse() ) {
+            wxCriticalSectionLocker lock(m_nmea_lock);
+            if( !wxIsNaN(nmea.Hdm.DegreesMagnetic) ) {
+                wxDateTime now = SampleTime(nmea);
+                double heading = nmea.Hdm.DegreesMagnetic + m_declination;
+                InputNoise(heading);
+                if(m_bHeadingKalman)
+                    EstimateHeading(m_heading_kalman, now, heading, COMPASS_VARIANCE);
+                else {
+                    m_heading_filter.Rotate(HeadingTurn(now));
+                    FilterAngle(m_heading_filter, heading, FilterGain(m_heading_time, now));
+                }
+                updated = true;
+            }
         }
-    } else if( m_currenttool == HEADING_UP && m_NMEA0183.LastSentenceIDReceived == _T("HDM") ) {
-        if( m_NMEA0183.Parse() ) {
-            if( !wxIsNaN(m_NMEA0183.Hdm.DegreesMagnetic) )
-                m_heading = FilterAngle(m_NMEA0183.Hdm.DegreesMagnetic, m_heading - Declination()) + Declination();
+    } else if( tool == HEADING_UP && nmea.LastSentenceReceived == SID_ROT ) {
+        if( nmea.Parse() && nmea.Rot.IsDataValid == NTrue && !wxIsNaN(nmea.Rot.RateOfTurn) ) {
+            wxCriticalSectionLocker lock(m_nmea_lock);
+            m_rate_of_turn = nmea.Rot.RateOfTurn / 60;
+            m_rate_of_turn_time = SampleTime(nmea);
+            m_heading_kalman.RateOfTurn(Seconds(m_rate_of_turn_time), m_rate_of_turn,
+                                        RATE_OF_TURN_VARIANCE);
+            updated = true;
         }
     }
     // NMEA 0183 standard Wind Direction and Speed, with respect to north.
-    else if( m_currenttool == WIND_UP && m_NMEA0183.LastSentenceIDReceived == _T("MWV") ) {
-        if( m_NMEA0183.Parse() && m_NMEA0183.Mwv.IsDataValid == NTrue ) {
-            if( m_NMEA0183.Mwv.WindAngle < 999. ) { //if WindAngleTrue is available, use i
+    else if( tool == WIND_UP && nmea.LastSentenceReceived == SID_MWV ) {
+        if( nmea.Parse() && nmea.Mwv.IsDataValid == NTrue ) {
+            wxCriticalSectionLocker lock(m_nmea_lock);
+            if( nmea.Mwv.WindAngle < 999. ) { //if WindAngleTrue is available, use i
                 double truewind;
-                if(m_NMEA0183.Mwv.Reference == _T("R")) {
+                if(nmea.Mwv.Reference == _T("R")) {
                     double SpeedFactor = 1.0; //knots ("N")
-                    if (m_NMEA0183.Mwv.WindSpeedUnits == _T("K") ) SpeedFactor = 0.53995 ; //km/h > knots
-                    if (m_NMEA0183.Mwv.WindSpeedUnits == _T("M") ) SpeedFactor = 1.94384;
-                    double VA = m_NMEA0183.Mwv.WindSpeed * SpeedFactor;
+                    if (nmea.Mwv.WindSpeedUnits == _T("K") ) SpeedFactor = 0.53995 ; //km/h > knots
+                    if (nmea.Mwv.WindSpeedUnits == _T("M") ) SpeedFactor = 1.94384;
+                    double VA = nmea.Mwv.WindSpeed * SpeedFactor;
                     // need to calculate true wind here
                     double VB = m_lastfix.Sog;
-                    double A = m_NMEA0183.Mwv.WindAngle;
+                    double A = nmea.Mwv.WindAngle;
 /*
             Law of cosines;
            ________________________
@@ -483,11 +803,13 @@ void rotationctrl_pi::SetNMEASentence( wxString &sentence )
                     truewind = W;
                 } else {
                     // already true wind
-                    truewind = m_NMEA0183.Mwv.WindAngle;
+                    truewind = nmea.Mwv.WindAngle;
                 }
 
-                truewind = heading_resolve(truewind + m_lastfix.Cog);
-                m_truewind = FilterAngle(truewind, m_truewind);
+                InputNoise(truewind + m_lastfix.Cog);
+                FilterAngle(m_truewind_filter, truewind + m_lastfix.Cog,
+                            FilterGain(m_truewind_time, SampleTime(nmea)));
+                updated = true;
             }
         }
     }
@@ -500,12 +822,12 @@ void rotationctrl_pi::SetNMEASentence( wxString &sentence )
 
         /* NMEA 0183 Relative (Apparent) Wind Speed and Angle. Wind angle in relation
          * to the vessel's heading, and wind speed measured relative to the moving vessel. */
-        else if( m_NMEA0183.LastSentenceIDReceived == _T("VWR") ) {
-            if( m_NMEA0183.Parse() ) {
+        else if( nmea.LastSentenceReceived == SID_VWR ) {
+            if( nmea.Parse() ) {
 
                     wxString awaunit;
-                    awaunit = m_NMEA0183.Vwr.DirectionOfWind == Left ? _T("\u00B0L") : _T("\u00B0R");
-                    m_NMEA0183.Vwr.WindDirectionMagnitude;
+                    awaunit = nmea.Vwr.DirectionOfWind == Left ? _T("\u00B0L") : _T("\u00B0R");
+                    nmea.Vwr.WindDirectionMagnitude;
                 }
             }
         }
@@ -514,14 +836,16 @@ void rotationctrl_pi::SetNMEASentence( wxString &sentence )
          * (apparent) wind vector and the vessel's velocity vector relative to the water along
          * the heading line of the vessel. It represents the wind at the vessel if it were
          * stationary relative to the water and heading in the same direction. */
-        else if( m_NMEA0183.LastSentenceIDReceived == _T("VWT") ) {
-            if( m_NMEA0183.Parse() ) {
-                    vwtunit = m_NMEA0183.Vwt.DirectionOfWind == Left ? _T("\u00B0L") : _T("\u00B0R");
-                    m_NMEA0183.Vwt.WindDirectionMagnitude;
+        else if( nmea.LastSentenceReceived == SID_VWT ) {
+            if( nmea.Parse() ) {
+                    vwtunit = nmea.Vwt.DirectionOfWind == Left ? _T("\u00B0L") : _T("\u00B0R");
+                    nmea.Vwt.WindDirectionMagnitude;
                 }
             }
         }
 #endif
+
+    return updated;
 }
 
 void rotationctrl_pi::SetPositionFixEx(PlugIn_Position_Fix_Ex &pfix)
@@ -541,9 +865,21 @@ void rotationctrl_pi::SetPositionFixEx(PlugIn_Position_Fix_Ex &pfix)
 #endif
 
     if(pfix.FixTime && pfix.nSats)
-        m_LastFixTime = wxDateTime::Now();
+        m_LastFixTime = Clock();
 
-    m_lastfix = pfix;
+    {
+        wxCriticalSectionLocker lock(m_nmea_lock);
+        m_lastfix = pfix;
+        if(m_currenttool == COURSE_UP)
+            InputNoise(pfix.Cog);
+
+        if(m_bHeadingKalman)
+            EstimateHeading(m_cog_kalman, Clock(), pfix.Cog, CogVariance(pfix.Sog),
+                            m_currenttool == COURSE_UP);
+    }
+
+    if(m_currenttool == COURSE_UP || m_currenttool == ROUTE_UP)
+        InputUpdated();
 }
 
 void rotationctrl_pi::SetPluginMessage(wxString &message_id, wxString &message_body)
@@ -556,22 +892,91 @@ void rotationctrl_pi::SetPluginMessage(wxString &message_id, wxString &message_b
         r.Parse(message_body, &v);
         m_routeguid = v[_T("GUID")].AsString();
         Reset();
-        m_Timer.Start(1, true); // start right away
+        ScheduleUpdate(1); // start right away
     }
 
     if(message_id == _T("OCPN_WPT_ARRIVED"))
     {
         m_routeguid = v[_T("GUID")].AsString();
         Reset();
-        m_Timer.Start(1, true); // start right away
+        ScheduleUpdate(1); // start right away
+    } else if(message_id == _T("ROTATIONCTRL_NMEA_STATISTICS_REQUEST")) {
+        wxJSONWriter w;
+        wxString out;
+        w.Write(NMEAStatistics(), out);
+        SendPluginMessage(wxString(_T("ROTATIONCTRL_NMEA_STATISTICS")), out);
     } else if(message_id == _T("WMM_VARIATION_BOAT")) {
         if(r.Parse( message_body, &v ) == 0) {
-            v[_T("Decl")].AsString().ToDouble(&m_declination);
-            m_declinationTime = wxDateTime::Now();
+            double declination;
+            if(v[_T("Decl")].AsString().ToDouble(&declination)) {
+                wxCriticalSectionLocker lock(m_nmea_lock);
+                m_declination = declination;
+            }
+            m_declinationTime = Clock();
         }
     }
 }
 
+// counters of whichever parser is in use, safe to call from the gui thread
+void rotationctrl_pi::GetNMEAStatistics(PARSE_STATISTICS &statistics)
+{
+    if(m_NMEAThread)
+        m_NMEAThread->GetStatistics(statistics);
+    else
+        statistics = m_NMEA0183.Statistics;
+}
+
+static wxJSONValue SentenceStatistics(const SENTENCE_STATISTICS &counts)
+{
+    wxJSONValue v;
+    v[_T("received")] = counts.Received;
+    v[_T("parsed")] = counts.Parsed;
+    v[_T("rejected")][_T("checksum")] = counts.ChecksumRejects;
+    v[_T("rejected")][_T("fields")] = counts.FieldErrors;
+    v[_T("bytes")] = (double)counts.Bytes;
+
+    if(counts.TimedParses) {
+        wxJSONValue &timing = v[_T("parse_time")];
+        timing[_T("samples")] = counts.TimedParses;
+        timing[_T("mean_ns")] = (double)counts.TimedNanoseconds / counts.TimedParses;
+        // [limit in ns, parses below it], the last bucket has no limit
+        for(int i=0; i<NMEA0183_TIMING_BUCKETS; i++) {
+            wxJSONValue bucket;
+            bucket.Append((double)PARSE_STATISTICS::BucketLimit(i));
+            bucket.Append(counts.ParseTime[i]);
+            timing[_T("histogram")].Append(bucket);
+        }
+    }
+    return v;
+}
+
+wxJSONValue rotationctrl_pi::NMEAStatistics()
+{
+    PARSE_STATISTICS statistics;
+    GetNMEAStatistics(statistics);
+
+    wxJSONValue v;
+    v[_T("screened")] = m_sentences_screened; // never reached the parser
+    v[_T("dropped")] = m_NMEAThread ? m_NMEAThread->Dropped() : 0ul;
+    v[_T("not_sentences")] = statistics.NotSentences;
+    v[_T("oversized")] = statistics.Oversized + (m_NMEAThread ? m_NMEAThread->Oversized() : 0ul);
+
+    SENTENCE_STATISTICS total;
+    statistics.Total(total);
+    v[_T("total")] = SentenceStatistics(total);
+
+    // unknown mnemonics all land under SID_Unknown
+    for(int i=0; i<SID_Count; i++) {
+        const SENTENCE_STATISTICS &counts = statistics.Sentence[i];
+        if(!counts.Received)
+            continue;
+        wxString mnemonic = i == SID_Unknown ? wxString(_T("unknown"))
+            : m_NMEA0183.GetMnemonic((SENTENCE_ID)i);
+        v[_T("sentences")][mnemonic] = SentenceStatistics(counts);
+    }
+    return v;
+}
+
 void rotationctrl_pi::ShowPreferencesDialog( wxWindow* parent )
 {
     {
@@ -582,27 +987,174 @@ void rotationctrl_pi::ShowPreferencesDialog( wxWindow* parent )
     LoadConfig();
 }
 
-double rotationctrl_pi::FilterAngle(double input, double last, bool resetlimit)
+// first order low pass gain for a sample dt after the previous one,
+// 1 - exp(-dt/FilterSeconds), so the time constant does not depend on how
+// often a sensor sends or the timer runs.  Advances last to now.  Call
+// with m_nmea_lock held
+double rotationctrl_pi::FilterGain(wxDateTime &last, const wxDateTime &now)
+{
+    if(!last.IsValid() || m_filter_seconds <= 0) {
+        last = now;
+        return 1;
+    }
+
+    double dt = (now - last).GetMilliseconds().ToDouble() / 1000.0;
+    if(dt <= 0) // same instant, or out of order: no time for it to act
+        return 0;
+
+    last = now;
+    return 1 - exp(-dt / m_filter_seconds);
+}
+
+// until the chart has turned to the first value samples are taken as they come
+void rotationctrl_pi::FilterAngle(AngleFilter &filter, double input, double gain, bool resetlimit)
 {
     if(isnan(input))
-        return last;
+        return;
 
-    if(isnan(last))
-        return input;
+    filter.Update(input, m_LimitRotation ? gain : 1);
+    if(resetlimit)
+        m_LimitFilter = true;
+}
+
+// when the sentence was measured, on our clock: the tag block time if the
+// source sent one fine enough to tell its samples apart, otherwise when it
+// arrived.  Call with m_nmea_lock held.
+wxDateTime rotationctrl_pi::SampleTime(NMEA0183 &nmea)
+{
+    wxDateTime now = Clock();
+    if(!nmea.TagBlock.HasTime())
+        return now;
+
+    // the source clock is not ours; the smallest delay seen is the best
+    // guess at the offset since network bursts only ever make sentences
+    // late.  Creep upward so drift is followed, start over on a clock step.
+    double tag = nmea.TagBlock.Time;
+    double offset = now.GetValue().ToDouble() / 1000.0 - tag;
+    if(isnan(m_tag_clock_offset) || offset < m_tag_clock_offset ||
+       offset - m_tag_clock_offset > 5)
+        m_tag_clock_offset = offset;
+    else
+        m_tag_clock_offset += (offset - m_tag_clock_offset) / 1000;
+
+    if(tag != m_tag_time) {
+        m_tag_spacing = fabs(tag - m_tag_time);
+        m_tag_time = tag;
+    }
 
-    double x = sin(deg2rad(input)), y = cos(deg2rad(input));
-    double lx = sin(deg2rad(last)), ly = cos(deg2rad(last));
+    double delay = offset - m_tag_clock_offset; // seconds since it was measured
+    wxDateTime time;
+    if(isnan(m_tag_spacing) || nmea.TagBlock.TimeResolution < m_tag_spacing)
+        time = now - wxTimeSpan::Milliseconds(wxLongLong((long)(delay * 1000)));
+    else {
+        // several samples share each tag (whole seconds from a faster
+        // source), it can't order them.  Only the delay past its resolution
+        // is taken from the arrival time, and each comes after the last
+        // so the filters don't pass it over as taking no time.
+        delay = wxMax(delay - nmea.TagBlock.TimeResolution, 0.0);
+        time = now - wxTimeSpan::Milliseconds(wxLongLong((long)(delay * 1000)));
+        if(m_sample_time.IsValid() && time <= m_sample_time)
+            time = m_sample_time + wxTimeSpan::Milliseconds(1);
+    }
+
+    m_sample_time = time;
+    return time;
+}
+
+// degrees turned by the rate of turn since the last heading sample.  The
+// filter is carried through the turn before each sample, so the chart keeps
+// up without a shorter time constant.  call with m_nmea_lock held
+double rotationctrl_pi::HeadingTurn(const wxDateTime &now)
+{
+    if(!m_heading_time.IsValid() || !m_rate_of_turn_time.IsValid())
+        return 0;
 
-    if(m_LimitRotation) {
-        x = m_filter_lp*x + (1-m_filter_lp)*lx;
-        y = m_filter_lp*y + (1-m_filter_lp)*ly;
-    } if(resetlimit)
-          m_LimitFilter = true;
+    if((now - m_rate_of_turn_time).GetMilliseconds().ToLong() > 3000)
+        return 0; // rate of turn is stale
 
-    return rad2deg(atan2(x, y));
+    double dt = (now - m_heading_time).GetMilliseconds().ToLong() / 1000.0;
+    if(dt < 0)
+        return 0;
+    if(dt > 2) /* heading samples stopped, don't spin the chart on a guess */
+        dt = 2;
+
+    return m_rate_of_turn * dt;
+}
+
+// the kalman counterpart of FilterAngle, with the same hold on the first
+// rotation.  Call with m_nmea_lock held
+void rotationctrl_pi::EstimateHeading(HeadingKalman &kalman, const wxDateTime &time,
+                                      double degrees, double variance, bool resetlimit)
+{
+    if(isnan(degrees))
+        return;
+
+    kalman.Heading(Seconds(time), degrees, variance);
+    if(resetlimit)
+        m_LimitFilter = true;
+}
+
+// a rate of turn measured, or estimated with the heading, rather than taken
+// from how the filtered angle moves; NAN if there is none.  Call with
+// m_nmea_lock held
+double rotationctrl_pi::MeasuredTurnRate(const wxDateTime &now)
+{
+    if(m_bHeadingKalman && m_currenttool == HEADING_UP)
+        return m_heading_kalman.Rate();
+    if(m_bHeadingKalman && m_currenttool == COURSE_UP)
+        return m_cog_kalman.Rate();
+    if(m_currenttool == HEADING_UP && m_rate_of_turn_time.IsValid() &&
+       (now - m_rate_of_turn_time).GetMilliseconds().ToLong() < 3000)
+        return m_rate_of_turn;
+    return NAN;
+}
+
+// the next update period: how long the chart takes at the rate it is
+// turning to move by a step worth drawing, a larger step when the input is
+// noisy
+void rotationctrl_pi::AdaptPeriod(double rotation, double measured_rate,
+                                  double input_variance, const wxDateTime &now)
+{
+    if(m_target_time.IsValid() && !isnan(m_target)) {
+        double dt = (now - m_target_time).GetMilliseconds().ToLong() / 1000.0;
+        if(dt > 0) {
+            // up at once so a tack is caught, down over the filter time
+            double rate = fabs(heading_resolve(rotation - m_target, 0)) / dt;
+            if(rate > m_turn_rate || m_filter_seconds <= 0)
+                m_turn_rate = rate;
+            else
+                m_turn_rate += (1 - exp(-dt / m_filter_seconds)) * (rate - m_turn_rate);
+        }
+    }
+    m_target = rotation;
+    m_target_time = now;
+
+    // a measured rate of turn sees the tack before the filtered angle does
+    double rate = m_turn_rate;
+    if(!isnan(measured_rate))
+        rate = wxMax(rate, fabs(measured_rate));
+
+    double step = wxMax(ADAPTIVE_STEP_DEGREES, 2 * sqrt(input_variance));
+    double msecs = rate > 0 ? 1000 * step / rate : m_filter_msecs;
+    m_update_msecs = (int)wxMax((double)m_min_update_msecs, wxMin(msecs, (double)m_filter_msecs));
+}
+
+// the scatter of the input of the current tool from one sample to the
+// next, which a turn adds little to at the rate sentences come.  Call with
+// m_nmea_lock held
+void rotationctrl_pi::InputNoise(double degrees)
+{
+    if(isnan(degrees))
+        return;
+
+    if(!isnan(m_noise_input)) {
+        double d = heading_resolve(degrees - m_noise_input, 0);
+        m_input_variance += NOISE_GAIN * (d * d / 2 - m_input_variance);
+    }
+    m_noise_input = degrees;
 }
 
-double rotationctrl_pi::FilterSpeed(double input, double last)
+double rotationctrl_pi::FilterSpeed(double input, double last, double gain)
 {
     if(isnan(input))
         return last;
@@ -610,17 +1162,17 @@ double rotationctrl_pi::FilterSpeed(double input, double last)
     if(isnan(last))
         return input;
 
-    return m_filter_lp*input + (1-m_filter_lp)*last;
+    return gain*input + (1-gain)*last;
 }
 
 double rotationctrl_pi::Declination()
 {
     if(m_declinationRequestTime.IsValid() &&
-       (wxDateTime::Now() - m_declinationRequestTime).GetSeconds() < 6)
+       (Clock() - m_declinationRequestTime).GetSeconds() < 6)
         return m_declination;
-    m_declinationRequestTime = wxDateTime::Now();
+    m_declinationRequestTime = Clock();
 
-    if(!m_declinationTime.IsValid() || (wxDateTime::Now() - m_declinationTime).GetSeconds() > 1200) {
+    if(!m_declinationTime.IsValid() || (Clock() - m_declinationTime).GetSeconds() > 1200) {
         wxJSONWriter w;
         wxString out;
         wxJSONValue v;
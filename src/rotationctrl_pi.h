@@ -76,11 +76,16 @@ inline double deg2rad(double degrees) { return M_PI * degrees / 180.0; }
 inline double rad2deg(double radians) { return 180.0 * radians / M_PI; }
 
 #include <nmea0183.h>
+#include "AngleFilter.h"
+#include "HeadingKalman.h"
+#include "jsonval.h"
 
 //----------------------------------
 //    The PlugIn Class Definition
 //----------------------------------
 
+class NMEAThread;
+
 #define TOOL_POSITION    -1          // Request default positioning of toolbar tool
 
 enum RotationTools {MANUAL_CCW, MANUAL_CW, MANUAL_TILTUP, MANUAL_TILTDOWN,
@@ -89,6 +94,8 @@ enum RotationTools {MANUAL_CCW, MANUAL_CW, MANUAL_TILTUP, MANUAL_TILTDOWN,
 
 class rotationctrl_pi : public wxEvtHandler, public opencpn_plugin_113
 {
+    friend class NMEAThread;
+
 public:
 
     rotationctrl_pi(void *ppimgr);
@@ -123,22 +130,53 @@ public:
 
       wxDateTime m_LastFixTime;
 
-      double m_sog, m_cog; // from gps
-      double m_heading, m_truewind;
-
-      int m_filter_msecs;
-      double m_filter_lp;
+      double m_sog; // from gps
+      AngleFilter m_cog_filter, m_heading_filter, m_truewind_filter; // all true
+      HeadingKalman m_cog_kalman, m_heading_kalman; // instead, if m_bHeadingKalman
+      double m_rate_of_turn; // degrees per second from ROT, positive to starboard
+      wxDateTime m_heading_time, m_rate_of_turn_time;
+      wxDateTime m_cog_time, m_route_heading_time, m_truewind_time; // last filtered
+      double m_tag_clock_offset; // seconds from tag block time to ours
+      double m_tag_time, m_tag_spacing; // last tag block time, and the step to it
+      wxDateTime m_sample_time; // last SampleTime from a tag block
+
+      int m_filter_msecs; // longest update period, on a steady course
+      double m_filter_seconds; // time constant of the filters
+      bool m_bHeadingKalman; // estimate heading and course with rate of turn
       double m_max_slew_rate;
       double m_rotation_offset;
-      bool m_bSlewRefresh;
+      double m_animation_fps;
       bool m_LimitRotation, m_LimitFilter;
 
       int               m_leftclick_tool_ids[NUM_ROTATION_TOOLS];
 
 protected:
 
-      double FilterAngle(double input, double last, bool resetlimit=true);
-      double FilterSpeed(double input, double last);
+      double FilterGain(wxDateTime &last, const wxDateTime &now);
+      void FilterAngle(AngleFilter &filter, double input, double gain, bool resetlimit=true);
+      void EstimateHeading(HeadingKalman &kalman, const wxDateTime &time, double degrees,
+                           double variance, bool resetlimit=true);
+      double MeasuredTurnRate(const wxDateTime &now);
+      void AdaptPeriod(double rotation, double measured_rate, double input_variance,
+                       const wxDateTime &now);
+      void InputNoise(double degrees);
+      double FilterSpeed(double input, double last, double gain);
+      double HeadingTurn(const wxDateTime &now);
+      wxDateTime SampleTime(NMEA0183 &nmea);
+
+      // the clock and timer, overridden to replay logs on a virtual clock
+      virtual wxDateTime Clock() { return wxDateTime::UNow(); }
+      virtual void StartTimer(int msecs);
+      virtual void StopTimer();
+      void TimerElapsed();
+      void ArmTimer();
+      void ScheduleUpdate(int msecs);
+      void CancelUpdate();
+      void InputUpdated();
+      void UpdateRotation();
+      bool AnimationAt(const wxDateTime &now, double &angle, double &rate);
+      void AnimateTo(double target, const wxDateTime &now);
+      void AnimationFrame(const wxDateTime &now);
 
       PlugIn_Position_Fix_Ex m_lastfix; // m_lasttimerfix;
 
@@ -148,6 +186,10 @@ private:
 
       void SetCurrentViewPort(PlugIn_ViewPort &vp);
       void SetNMEASentence( wxString &sentence );
+      unsigned int SubscribedSentences( int tool );
+      bool ProcessNMEA( NMEA0183 &nmea, int tool );
+      void GetNMEAStatistics(PARSE_STATISTICS &statistics);
+      wxJSONValue NMEAStatistics();
       void SetPositionFixEx(PlugIn_Position_Fix_Ex &pfix);
       void SetPluginMessage(wxString &message_id, wxString &message_body);
 
@@ -156,15 +198,35 @@ private:
       void Reset();
 
       wxTimer m_Timer;
+      wxDateTime m_update_due, m_last_update; // one-shot pending, last run
+
+      // the update period adapts between these to the turn rate and noise
+      int m_update_msecs, m_min_update_msecs;
+      double m_target, m_turn_rate; // last rotation, degrees per second
+      wxDateTime m_target_time;
+      double m_noise_input, m_input_variance; // last input, its scatter
+
+      // the chart eases from m_animation_from through m_animation_delta
+      // degrees, starting at m_animation_rate degrees per second
+      double m_animation_from, m_animation_delta, m_animation_rate, m_animation_seconds;
+      wxDateTime m_animation_start, m_frame_due;
+
       PlugIn_Waypoint m_routewaypoint;
 
-      double m_route_heading;
+      AngleFilter m_route_filter;
       wxString m_routeguid;
 
       PlugIn_ViewPort m_vp;
       int m_currenttool;
 
       NMEA0183 m_NMEA0183;
+      unsigned long m_sentences_screened; // dropped by SetNMEASentence unparsed
+
+      // optional: parse and filter nmea on a worker thread
+      bool m_bNMEAThread;
+      NMEAThread *m_NMEAThread;
+      // guards the filtered angles, filter state, m_lastfix and m_declination
+      wxCriticalSection m_nmea_lock;
 
       double m_rotation_dir, m_tilt_dir;
       wxDateTime m_last_rotation_time;
@@ -0,0 +1,134 @@
+/******************************************************************************
+ *
+ * Project:  OpenCPN
+ * Purpose:  angle filter benchmark
+ * Author:   Sean D'Epagnier
+ *
+ ***************************************************************************
+ *   Copyright (C) 2018 by Sean D'Epagnier                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+// Times AngleFilter against filtering angles the way the plugin did before,
+// turning the last output back into a vector on every sample:
+//
+//    angle_bench [samples per update] [seconds]
+//
+// A 10 Hz compass on a 1 second update period is 10 samples per update,
+// the default.  Both filters are fed the same noisy heading through a
+// turn, the largest difference between their outputs is printed so a
+// change to either can be checked, and the libm calls each makes.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+
+#include "AngleFilter.h"
+
+static double Seconds()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// the filter state as an angle, converted both ways every sample
+struct AngleStateFilter
+{
+    double angle = NAN;
+
+    void Update(double degrees, double gain) {
+        if(isnan(angle)) {
+            angle = degrees;
+            return;
+        }
+        double x = sin(degrees * M_PI / 180), y = cos(degrees * M_PI / 180);
+        double lx = sin(angle * M_PI / 180), ly = cos(angle * M_PI / 180);
+        x = gain * x + (1 - gain) * lx;
+        y = gain * y + (1 - gain) * ly;
+        angle = atan2(x, y) * 180 / M_PI;
+    }
+
+    double Angle() const { return angle < 0 ? angle + 360 : angle; }
+};
+
+template<class Filter>
+static double Run(const std::vector<double> &samples, int per_update, double gain,
+                  double seconds, std::vector<double> &outputs, unsigned long &count)
+{
+    double start = Seconds(), elapsed;
+    volatile double sink = 0;
+    count = 0;
+    do {
+        Filter filter;
+        outputs.clear();
+        for(size_t i = 0; i < samples.size(); i++) {
+            filter.Update(samples[i], gain);
+            if(i % per_update == per_update - 1) {
+                double angle = filter.Angle();
+                outputs.push_back(angle);
+                sink = sink + angle;
+            }
+        }
+        count += samples.size();
+        elapsed = Seconds() - start;
+    } while(elapsed < seconds);
+    return elapsed * 1e9 / count;
+}
+
+int main(int argc, char **argv)
+{
+    int per_update = argc > 1 ? atoi(argv[1]) : 10;
+    double seconds = argc > 2 ? atof(argv[2]) : 0.5;
+    if(per_update < 1)
+        per_update = 1;
+
+    // a slow turn through north with a degree or two of noise
+    std::vector<double> samples(100000);
+    srand(1);
+    for(size_t i = 0; i < samples.size(); i++) {
+        double heading = 300 + 120.0 * i / samples.size() + (rand() % 400 - 200) / 100.0;
+        samples[i] = fmod(heading, 360);
+    }
+
+    double gain = 1 - exp(-0.1 / 5); // 10 Hz through a 5 second time constant
+
+    std::vector<double> a, b;
+    unsigned long count;
+    double angle_ns = Run<AngleStateFilter>(samples, per_update, gain, seconds, a, count);
+    double vector_ns = Run<AngleFilter>(samples, per_update, gain, seconds, b, count);
+
+    double worst = 0;
+    for(size_t i = 0; i < a.size() && i < b.size(); i++) {
+        double d = fabs(fmod(a[i] - b[i] + 540, 360) - 180);
+        if(d > worst)
+            worst = d;
+    }
+
+    // per update: samples * (sin cos) plus the output's atan2 versus
+    // samples * (sin cos sin cos atan2)
+    double angle_calls = 5.0;
+    double vector_calls = 2.0 + 1.0 / per_update;
+
+    printf("%d samples per update, %lu samples\n\n", per_update, count);
+    printf("%-12s %12s %16s\n", "filter", "ns/sample", "libm calls/sample");
+    printf("%-12s %12.1f %16.2f\n", "angle", angle_ns, angle_calls);
+    printf("%-12s %12.1f %16.2f\n", "vector", vector_ns, vector_calls);
+    printf("\nspeedup %.2fx, outputs differ by at most %g degrees\n", angle_ns / vector_ns, worst);
+    return 0;
+}
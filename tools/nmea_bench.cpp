@@ -0,0 +1,187 @@
+/******************************************************************************
+ *
+ * Project:  OpenCPN
+ * Purpose:  NMEA0183 parser benchmark
+ * Author:   Sean D'Epagnier
+ *
+ ***************************************************************************
+ *   Copyright (C) 2018 by Sean D'Epagnier                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+// Times the parser per sentence type over a recorded corpus:
+//
+//    nmea_bench [corpus.nmea] [seconds per sentence type]
+//
+// Every sentence is Assign()ed and Parse()d from the framed bytes, the way
+// the plugin's NMEA thread does it, so the numbers include dispatch and the
+// checksum but not wxString conversion.  Last BULK_DECODER runs over the
+// corpus repeated to 64 MB, on one thread and then on more, to show how
+// it scales.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <new>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nmea0183.h>
+
+#ifndef NMEA_BENCH_CORPUS
+#define NMEA_BENCH_CORPUS "data/sailing.nmea"
+#endif
+
+// count every allocation, the parser is meant to need none once warm
+static unsigned long allocations;
+
+void *operator new(size_t size)
+{
+    allocations++;
+    void *p = malloc(size ? size : 1);
+    if(!p)
+        throw std::bad_alloc();
+    return p;
+}
+
+void *operator new[](size_t size) { return operator new(size); }
+void operator delete(void *p) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+void operator delete[](void *p, size_t) noexcept { free(p); }
+
+static double Seconds()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+
+int main(int argc, char **argv)
+{
+    const char *path = argc > 1 ? argv[1] : NMEA_BENCH_CORPUS;
+    double seconds = argc > 2 ? atof(argv[2]) : 0.2;
+
+    FILE *f = fopen(path, "rb");
+    if(!f) {
+        fprintf(stderr, "nmea_bench: can not open %s\n", path);
+        return 1;
+    }
+
+    std::string corpus;
+    char buffer[4096];
+    size_t n;
+    while((n = fread(buffer, 1, sizeof buffer, f)) > 0)
+        corpus.append(buffer, n);
+    fclose(f);
+
+    NMEA0183 nmea;
+
+    // frame once and sort the sentences by type
+    std::vector< std::vector<std::string> > groups(SID_Count);
+    unsigned long total_sentences = 0;
+    {
+        FRAMER framer;
+        framer.Write(corpus.data(), corpus.size());
+        const char *sentence;
+        int length;
+        while(framer.Next(sentence, length)) {
+            nmea.Assign(sentence, length);
+            nmea.PreParse();
+            groups[nmea.LastSentenceReceived].push_back(std::string(sentence, length));
+            total_sentences++;
+        }
+    }
+
+    printf("%s: %lu sentences, %lu bytes\n\n", path, total_sentences, (unsigned long)corpus.size());
+    printf("%-8s %8s %12s %14s\n", "type", "count", "ns/sentence", "allocs/sentence");
+
+    for(int sid = 0; sid < SID_Count; sid++) {
+        std::vector<std::string> &group = groups[sid];
+        if(group.empty())
+            continue;
+
+        // warm up, the first sentences may size buffers (RTE, GSV)
+        for(size_t i = 0; i < group.size(); i++) {
+            nmea.Assign(group[i].data(), group[i].size());
+            nmea.Parse();
+        }
+
+        unsigned long parsed = 0;
+        unsigned long start_allocations = allocations;
+        double start = Seconds(), elapsed;
+        do {
+            for(size_t i = 0; i < group.size(); i++) {
+                nmea.Assign(group[i].data(), group[i].size());
+                nmea.Parse();
+            }
+            parsed += group.size();
+            elapsed = Seconds() - start;
+        } while(elapsed < seconds);
+
+        wxString mnemonic = sid == SID_Unknown ? wxString(_T("other")) : nmea.GetMnemonic((SENTENCE_ID)sid);
+        printf("%-8s %8lu %12.1f %14.3f\n", (const char *)mnemonic.ToAscii(),
+               (unsigned long)group.size(), elapsed * 1e9 / parsed,
+               (double)(allocations - start_allocations) / parsed);
+    }
+
+    // the whole stream as the plugin sees it: framing and parsing together
+    unsigned long parsed = 0;
+    unsigned long start_allocations = allocations;
+    double start = Seconds(), elapsed;
+    do {
+        FRAMER framer;
+        framer.Write(corpus.data(), corpus.size());
+        while(framer.Next(nmea)) {
+            nmea.Parse();
+            parsed++;
+        }
+        elapsed = Seconds() - start;
+    } while(elapsed < seconds * 5);
+
+    printf("\n%-8s %8lu %12.1f %14.3f  (%.1f MB/s)\n", "stream", total_sentences,
+           elapsed * 1e9 / parsed, (double)(allocations - start_allocations) / parsed,
+           parsed / (double)total_sentences * corpus.size() / elapsed / 1e6);
+
+    // bulk decoding of a log too big to be worth doing on one core
+    std::string log;
+    while(log.size() < 64 << 20)
+        log += corpus;
+
+    BULK_DECODER decoder;
+    decoder.Select(SID_HDT);
+    decoder.Select(SID_MWV);
+    decoder.Select(SID_RMC);
+    decoder.Select(SID_VTG);
+
+    printf("\n%-8s %8s %12s %14s\n", "bulk", "threads", "MB/s", "speedup");
+    int cores = std::thread::hardware_concurrency();
+    double single = 0;
+    for(int threads = 1; threads <= (cores > 1 ? cores : 1); threads *= 2) {
+        BULK_COLUMNS columns;
+        decoder.Threads = threads;
+        start = Seconds();
+        decoder.Decode(log.data(), log.size(), columns);
+        elapsed = Seconds() - start;
+        if(threads == 1)
+            single = elapsed;
+        printf("%-8s %8d %12.1f %14.2f\n", "", threads, log.size() / elapsed / 1e6, single / elapsed);
+    }
+
+    return 0;
+}
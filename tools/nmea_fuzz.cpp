@@ -0,0 +1,90 @@
+/******************************************************************************
+ *
+ * Project:  OpenCPN
+ * Purpose:  NMEA0183 parser fuzz target
+ * Author:   Sean D'Epagnier
+ *
+ ***************************************************************************
+ *   Copyright (C) 2018 by Sean D'Epagnier                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+// libFuzzer entry point for the parser.  Built with clang this links
+// against libFuzzer; with NMEA_FUZZ_MAIN defined it is a plain program
+// that replays the files named on the command line (a saved corpus or
+// crash reproducers).
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string>
+
+#include <nmea0183.h>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    // constructing the parser is not what is being fuzzed, and keeping it
+    // also carries GSV and RTE assembly state from one input to the next
+    static NMEA0183 nmea;
+
+    const char *text = (const char *)data;
+    int length = (int)size;
+
+    // the whole input as one sentence, straight from the bytes
+    nmea.Assign(text, length);
+    nmea.Parse();
+
+    // as a stream cut into two chunks, the cut chosen by the input
+    FRAMER framer;
+    int cut = length ? data[0] % (length + 1) : 0;
+    framer.Write(text, cut);
+    while(framer.Next(nmea))
+        nmea.Parse();
+    framer.Write(text + cut, length - cut);
+    while(framer.Next(nmea))
+        nmea.Parse();
+
+    // and the way OpenCPN hands sentences over
+    wxString sentence = wxString::FromAscii(std::string(text, size).c_str());
+    nmea << sentence;
+    nmea.Parse();
+
+    return 0;
+}
+
+#ifdef NMEA_FUZZ_MAIN
+int main(int argc, char **argv)
+{
+    for(int i = 1; i < argc; i++) {
+        FILE *f = fopen(argv[i], "rb");
+        if(!f) {
+            fprintf(stderr, "nmea_fuzz: can not open %s\n", argv[i]);
+            return 1;
+        }
+
+        std::string input;
+        char buffer[4096];
+        size_t n;
+        while((n = fread(buffer, 1, sizeof buffer, f)) > 0)
+            input.append(buffer, n);
+        fclose(f);
+
+        LLVMFuzzerTestOneInput((const uint8_t *)input.data(), input.size());
+    }
+    return 0;
+}
+#endif
@@ -0,0 +1,174 @@
+/******************************************************************************
+ *
+ * Project:  OpenCPN
+ * Purpose:  headless OpenCPN host for replays
+ * Author:   Sean D'Epagnier
+ *
+ ***************************************************************************
+ *   Copyright (C) 2018 by Sean D'Epagnier                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+#include <math.h>
+
+#include <wx/wx.h>
+
+#include "ocpn_host.h"
+#include "icons.h"
+
+OCPNHost g_host;
+
+// no toolbar to put them on
+wxBitmap *_img_ccw, *_img_courseup, *_img_cw, *_img_headingup, *_img_northup,
+    *_img_rotation, *_img_routeup, *_img_southup, *_img_tiltdown, *_img_tiltup,
+    *_img_t, *_img_windup;
+
+void initialize_images(void)
+{
+}
+
+// the plugin base classes, normally part of OpenCPN
+
+opencpn_plugin::~opencpn_plugin() {}
+int opencpn_plugin::Init(void) { return 0; }
+bool opencpn_plugin::DeInit(void) { return true; }
+int opencpn_plugin::GetAPIVersionMajor() { return 1; }
+int opencpn_plugin::GetAPIVersionMinor() { return 13; }
+int opencpn_plugin::GetPlugInVersionMajor() { return 1; }
+int opencpn_plugin::GetPlugInVersionMinor() { return 0; }
+wxBitmap *opencpn_plugin::GetPlugInBitmap() { return NULL; }
+wxString opencpn_plugin::GetCommonName() { return wxEmptyString; }
+wxString opencpn_plugin::GetShortDescription() { return wxEmptyString; }
+wxString opencpn_plugin::GetLongDescription() { return wxEmptyString; }
+void opencpn_plugin::SetDefaults(void) {}
+int opencpn_plugin::GetToolbarToolCount(void) { return 0; }
+int opencpn_plugin::GetToolboxPanelCount(void) { return 0; }
+void opencpn_plugin::SetupToolboxPanel(int page_sel, wxNotebook* pnotebook) {}
+void opencpn_plugin::OnCloseToolboxPanel(int page_sel, int ok_apply_cancel) {}
+void opencpn_plugin::ShowPreferencesDialog( wxWindow* parent ) {}
+bool opencpn_plugin::RenderOverlay(wxMemoryDC *pmdc, PlugIn_ViewPort *vp) { return false; }
+void opencpn_plugin::SetCursorLatLon(double lat, double lon) {}
+void opencpn_plugin::SetCurrentViewPort(PlugIn_ViewPort &vp) {}
+void opencpn_plugin::SetPositionFix(PlugIn_Position_Fix &pfix) {}
+void opencpn_plugin::SetNMEASentence(wxString &sentence) {}
+void opencpn_plugin::SetAISSentence(wxString &sentence) {}
+void opencpn_plugin::ProcessParentResize(int x, int y) {}
+void opencpn_plugin::SetColorScheme(PI_ColorScheme cs) {}
+void opencpn_plugin::OnToolbarToolCallback(int id) {}
+void opencpn_plugin::OnContextMenuItemCallback(int id) {}
+void opencpn_plugin::UpdateAuiStatus(void) {}
+wxArrayString opencpn_plugin::GetDynamicChartClassNameArray(void) { return wxArrayString(); }
+
+opencpn_plugin_18::opencpn_plugin_18(void *pmgr) : opencpn_plugin(pmgr) {}
+opencpn_plugin_18::~opencpn_plugin_18() {}
+bool opencpn_plugin_18::RenderOverlay(wxDC &dc, PlugIn_ViewPort *vp) { return false; }
+bool opencpn_plugin_18::RenderGLOverlay(wxGLContext *pcontext, PlugIn_ViewPort *vp) { return false; }
+void opencpn_plugin_18::SetPluginMessage(wxString &message_id, wxString &message_body) {}
+void opencpn_plugin_18::SetPositionFixEx(PlugIn_Position_Fix_Ex &pfix) {}
+
+opencpn_plugin_19::opencpn_plugin_19(void *pmgr) : opencpn_plugin_18(pmgr) {}
+opencpn_plugin_19::~opencpn_plugin_19() {}
+void opencpn_plugin_19::OnSetupOptions(void) {}
+
+opencpn_plugin_110::opencpn_plugin_110(void *pmgr) : opencpn_plugin_19(pmgr) {}
+opencpn_plugin_110::~opencpn_plugin_110() {}
+void opencpn_plugin_110::LateInit(void) {}
+
+opencpn_plugin_111::opencpn_plugin_111(void *pmgr) : opencpn_plugin_110(pmgr) {}
+opencpn_plugin_111::~opencpn_plugin_111() {}
+
+opencpn_plugin_112::opencpn_plugin_112(void *pmgr) : opencpn_plugin_111(pmgr) {}
+opencpn_plugin_112::~opencpn_plugin_112() {}
+bool opencpn_plugin_112::MouseEventHook( wxMouseEvent &event ) { return false; }
+void opencpn_plugin_112::SendVectorChartObjectInfo(wxString &chart, wxString &feature, wxString &objname,
+                                                   double lat, double lon, double scale, int nativescale) {}
+
+opencpn_plugin_113::opencpn_plugin_113(void *pmgr) : opencpn_plugin_112(pmgr) {}
+opencpn_plugin_113::~opencpn_plugin_113() {}
+bool opencpn_plugin_113::KeyboardEventHook( wxKeyEvent &event ) { return false; }
+void opencpn_plugin_113::OnToolbarToolDownCallback(int id) {}
+void opencpn_plugin_113::OnToolbarToolUpCallback(int id) {}
+
+PlugIn_Waypoint::PlugIn_Waypoint() : m_lat(0), m_lon(0), m_IsVisible(true), m_HyperlinkList(NULL) {}
+PlugIn_Waypoint::~PlugIn_Waypoint() {}
+
+// the api functions the plugin calls
+
+extern "C" DECL_EXP int InsertPlugInTool(wxString label, wxBitmap *bitmap, wxBitmap *bmpDisabled, wxItemKind kind,
+                                         wxString shortHelp, wxString longHelp, wxObject *clientData, int position,
+                                         int tool_sel, opencpn_plugin *pplugin)
+{
+    static int tool_id;
+    return ++tool_id;
+}
+
+extern "C" DECL_EXP void RemovePlugInTool(int tool_id) {}
+extern "C" DECL_EXP void SetToolbarToolViz(int item, bool viz) {}
+extern "C" DECL_EXP void SetToolbarItemState(int item, bool toggle) {}
+extern "C" DECL_EXP void RequestRefresh(wxWindow *) {}
+extern "C" DECL_EXP wxWindow *GetOCPNCanvasWindow() { return NULL; }
+extern "C" DECL_EXP bool AddLocaleCatalog( wxString catalog ) { return false; }
+
+extern "C" DECL_EXP wxFileConfig *GetOCPNConfigObject(void)
+{
+    return g_host.config;
+}
+
+extern "C" DECL_EXP void SendPluginMessage( wxString message_id, wxString message_body )
+{
+    if(message_id == _T("WMM_VARIATION_BOAT_REQUEST"))
+        g_host.variation_requested = true;
+}
+
+// plane sailing, close enough for a waypoint a few miles off
+extern "C" DECL_EXP void DistanceBearingMercator_Plugin(double lat0, double lon0, double lat1, double lon1,
+                                                        double *brg, double *dist)
+{
+    double dlon = lon0 - lon1;
+    if(dlon > 180) dlon -= 360;
+    if(dlon < -180) dlon += 360;
+    double east = dlon * cos((lat0 + lat1) / 2 * M_PI / 180), north = lat0 - lat1;
+
+    if(brg) {
+        *brg = atan2(east, north) * 180 / M_PI;
+        if(*brg < 0)
+            *brg += 360;
+    }
+    if(dist)
+        *dist = 60 * sqrt(east*east + north*north);
+}
+
+void SetCanvasRotation(double rotation)
+{
+    g_host.vp.rotation = rotation;
+    g_host.rotated = true;
+}
+
+double GetCanvasTilt() { return g_host.tilt; }
+void SetCanvasTilt(double tilt) { g_host.tilt = tilt; }
+
+bool GetSingleWaypoint( wxString GUID, PlugIn_Waypoint *pwaypoint )
+{
+    if(!g_host.have_waypoint)
+        return false;
+
+    pwaypoint->m_lat = g_host.waypoint_lat;
+    pwaypoint->m_lon = g_host.waypoint_lon;
+    pwaypoint->m_GUID = GUID;
+    return true;
+}
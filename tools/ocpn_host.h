@@ -0,0 +1,51 @@
+/******************************************************************************
+ *
+ * Project:  OpenCPN
+ * Purpose:  headless OpenCPN host for replays
+ * Author:   Sean D'Epagnier
+ *
+ ***************************************************************************
+ *   Copyright (C) 2018 by Sean D'Epagnier                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+#ifndef _OCPN_HOST_H_
+#define _OCPN_HOST_H_
+
+// The parts of the OpenCPN plugin API rotationctrl_pi uses, implemented
+// without a chart canvas so the plugin runs in a command line program.
+// What the plugin does to the canvas is left here for the driver to read.
+
+#include <wx/wx.h>
+#include <wx/fileconf.h>
+
+#include "ocpn_plugin.h"
+
+struct OCPNHost {
+    wxFileConfig *config;     // GetOCPNConfigObject()
+    PlugIn_ViewPort vp;       // the canvas, rotation in radians
+    double tilt;
+    bool rotated;             // SetCanvasRotation since the driver last looked
+    bool variation_requested; // the plugin asked the WMM plugin for declination
+    bool have_waypoint;       // GetSingleWaypoint() answers with this
+    double waypoint_lat, waypoint_lon;
+};
+
+extern OCPNHost g_host;
+
+#endif
@@ -0,0 +1,363 @@
+/******************************************************************************
+ *
+ * Project:  OpenCPN
+ * Purpose:  rotationctrl log replay
+ * Author:   Sean D'Epagnier
+ *
+ ***************************************************************************
+ *   Copyright (C) 2018 by Sean D'Epagnier                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+// Runs a recorded NMEA log through the plugin's own filtering and slew
+// logic as fast as the cpu allows, on a virtual clock:
+//
+//    rotation_replay [-t course|heading|route|wind] [-c opencpn.conf] [-o trace] log.nmea
+//
+// The plugin settings come from the [Settings/RotationCtrl] section of the
+// config file, the defaults without one.  Every rotation the plugin sets
+// is written as "seconds-into-the-log degrees", the timing to stderr.
+//
+// Sentences are timed by their tag block when they have one, the others
+// and those sharing a whole second tag are spread evenly between the
+// times around them.  RMC also makes the position fixes OpenCPN would
+// pass on, RMB the waypoint for route up.
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <cmath>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <wx/wx.h>
+#include <wx/init.h>
+#include <wx/sstream.h>
+#include <wx/wfstream.h>
+
+#include "jsonwriter.h"
+
+#include "rotationctrl_pi.h"
+#include "ocpn_host.h"
+
+static double Seconds()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// days since 1970-01-01 of a proleptic gregorian date
+static long DaysFromCivil(int y, int m, int d)
+{
+    y -= m <= 2;
+    long era = (y >= 0 ? y : y - 399) / 400;
+    long yoe = y - era * 400;
+    long doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    long doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+// hhmmss.ss on a day, NAN if either does not parse
+static double UTCSeconds(const wxString &time, int year, int month, int day)
+{
+    double hhmmss;
+    if(time.Len() < 6 || !time.ToCDouble(&hhmmss) || year < 1970 || month < 1 || day < 1)
+        return NAN;
+
+    int hms = (int)hhmmss;
+    return DaysFromCivil(year, month, day) * 86400.0 +
+        hms / 10000 * 3600 + hms / 100 % 100 * 60 + (hhmmss - hms / 100 * 100);
+}
+
+// the time a line carries on its own: tag block, RMC or ZDA
+static double LineTime(NMEA0183 &nmea)
+{
+    if(!nmea.PreParse())
+        return NAN;
+
+    if(nmea.TagBlock.HasTime())
+        return nmea.TagBlock.Time;
+
+    if(nmea.LastSentenceReceived == SID_RMC && nmea.Parse() && nmea.Rmc.Date.Len() == 6) {
+        long date;
+        if(!nmea.Rmc.Date.ToLong(&date))
+            return NAN;
+        int year = date % 100;
+        return UTCSeconds(nmea.Rmc.UTCTime, year < 80 ? 2000 + year : 1900 + year,
+                          date / 100 % 100, date / 10000);
+    }
+
+    if(nmea.LastSentenceReceived == SID_ZDA && nmea.Parse())
+        return UTCSeconds(nmea.Zda.UTCTime, nmea.Zda.Year, nmea.Zda.Month, nmea.Zda.Day);
+
+    return NAN;
+}
+
+struct Anchor {
+    long line;
+    double time;
+};
+
+// the plugin with a virtual clock and timer
+class ReplayPlugin : public rotationctrl_pi
+{
+public:
+    ReplayPlugin() : rotationctrl_pi(NULL), m_timer_armed(false), m_updates(0), m_rotations(0),
+                     m_update_seconds(0) {}
+
+    void Activate(int tool) { OnToolbarToolCallback(m_leftclick_tool_ids[tool]); }
+
+    // fire the timer for every deadline up to time, then move the clock there
+    void RunUntil(const wxDateTime &time, FILE *trace, const wxDateTime &start) {
+        while(m_timer_armed && m_timer_deadline <= time) {
+            m_now = m_timer_deadline;
+            m_timer_armed = false;
+
+            g_host.rotated = false;
+            double t0 = Seconds();
+            TimerElapsed();
+            if(g_host.rotated) {
+                // OpenCPN repaints, and passes the new viewport back
+                opencpn_plugin *plugin = this;
+                plugin->SetCurrentViewPort(g_host.vp);
+                fprintf(trace, "%.3f %.2f\n", (m_now - start).GetMilliseconds().ToDouble() / 1000,
+                        g_host.vp.rotation * 180 / M_PI);
+                m_rotations++;
+            }
+            m_update_seconds += Seconds() - t0;
+            m_updates++;
+        }
+
+        if(time > m_now)
+            m_now = time;
+    }
+
+    wxDateTime m_now;
+    bool m_timer_armed;
+    wxDateTime m_timer_deadline;
+
+    unsigned long m_updates, m_rotations;
+    double m_update_seconds;
+
+protected:
+    wxDateTime Clock() { return m_now; }
+    void StartTimer(int msecs) {
+        m_timer_deadline = m_now + wxTimeSpan::Milliseconds(msecs);
+        m_timer_armed = true;
+    }
+    void StopTimer() { m_timer_armed = false; }
+};
+
+static wxDateTime ToDateTime(double seconds)
+{
+    time_t whole = (time_t)floor(seconds);
+    return wxDateTime(whole) + wxTimeSpan::Milliseconds((long)((seconds - whole) * 1000));
+}
+
+static void Usage()
+{
+    fprintf(stderr, "usage: rotation_replay [-t course|heading|route|wind] [-c opencpn.conf] "
+            "[-o trace] log.nmea\n");
+    exit(1);
+}
+
+int main(int argc, char **argv)
+{
+    const char *log_path = NULL, *config_path = NULL, *trace_path = NULL;
+    int tool = HEADING_UP;
+
+    for(int i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "-t") && i + 1 < argc) {
+            const char *name = argv[++i];
+            if(!strcmp(name, "course")) tool = COURSE_UP;
+            else if(!strcmp(name, "heading")) tool = HEADING_UP;
+            else if(!strcmp(name, "route")) tool = ROUTE_UP;
+            else if(!strcmp(name, "wind")) tool = WIND_UP;
+            else Usage();
+        } else if(!strcmp(argv[i], "-c") && i + 1 < argc)
+            config_path = argv[++i];
+        else if(!strcmp(argv[i], "-o") && i + 1 < argc)
+            trace_path = argv[++i];
+        else if(argv[i][0] != '-' && !log_path)
+            log_path = argv[i];
+        else
+            Usage();
+    }
+    if(!log_path)
+        Usage();
+
+    wxInitializer initializer; // wxTimer and wxDateTime want an app object
+    if(!initializer.IsOk()) {
+        fprintf(stderr, "rotation_replay: wxWidgets failed to initialize\n");
+        return 1;
+    }
+
+    if(config_path) {
+        wxFileInputStream config_stream(wxString::FromUTF8(config_path));
+        if(!config_stream.IsOk()) {
+            fprintf(stderr, "rotation_replay: can not open %s\n", config_path);
+            return 1;
+        }
+        g_host.config = new wxFileConfig(config_stream);
+    } else {
+        wxStringInputStream config_stream(wxEmptyString);
+        g_host.config = new wxFileConfig(config_stream);
+    }
+    // one thread, so the replay is repeatable
+    g_host.config->Write(_T("/Settings/RotationCtrl/NMEAThread"), 0L);
+
+    FILE *trace = trace_path ? fopen(trace_path, "w") : stdout;
+    if(!trace) {
+        fprintf(stderr, "rotation_replay: can not write %s\n", trace_path);
+        return 1;
+    }
+
+    // first pass, find the lines that say what time it is
+    std::vector<Anchor> anchors;
+    long lines = 0;
+    {
+        FILE *f = fopen(log_path, "rb");
+        if(!f) {
+            fprintf(stderr, "rotation_replay: can not open %s\n", log_path);
+            return 1;
+        }
+
+        NMEA0183 nmea;
+        char line[NMEA0183_MAX_SENTENCE_LENGTH + 2];
+        while(fgets(line, sizeof line, f)) {
+            nmea.Assign(line, strcspn(line, "\r\n"));
+            double time = LineTime(nmea);
+            // lines sharing a whole second tag came in over that second
+            bool coarse = nmea.TagBlock.HasTime() && nmea.TagBlock.TimeResolution >= 1;
+            if(!std::isnan(time) && (anchors.empty() || time > anchors.back().time ||
+                                     (time == anchors.back().time && !coarse))) {
+                Anchor anchor = {lines, time};
+                anchors.push_back(anchor);
+            }
+            lines++;
+        }
+        fclose(f);
+    }
+
+    if(anchors.empty()) {
+        fprintf(stderr, "rotation_replay: no tag block, RMC or ZDA times in %s\n", log_path);
+        return 1;
+    }
+
+    ReplayPlugin plugin;
+    opencpn_plugin_18 &host_side = plugin; // the calls OpenCPN makes
+    plugin.m_now = ToDateTime(anchors[0].time);
+    wxDateTime start = plugin.m_now;
+
+    plugin.Init();
+    plugin.Activate(tool);
+
+    // second pass, feed the plugin the way OpenCPN would
+    FILE *f = fopen(log_path, "rb");
+    NMEA0183 nmea;
+    char line[NMEA0183_MAX_SENTENCE_LENGTH + 2];
+    size_t next = 0;
+    long index = 0, sentences = 0, fixes = 0;
+    int satellites = 0;
+    double nmea_seconds = 0, wall = Seconds();
+
+    while(fgets(line, sizeof line, f)) {
+        int length = strcspn(line, "\r\n");
+        line[length] = 0;
+
+        // between the anchors around this line, further apart than 10 s is
+        // a gap in the log and the lines stay with the earlier one
+        while(next < anchors.size() && anchors[next].line <= index)
+            next++;
+        double time = anchors[next ? next - 1 : 0].time;
+        if(next > 0 && next < anchors.size()) {
+            const Anchor &a = anchors[next - 1], &b = anchors[next];
+            if(b.time - a.time <= 10)
+                time = a.time + (b.time - a.time) * (index - a.line) / (b.line - a.line);
+        }
+        index++;
+
+        if(!length)
+            continue;
+
+        plugin.RunUntil(ToDateTime(time), trace, start);
+
+        double t0 = Seconds();
+        wxString sentence = wxString::FromAscii(line) + _T("\r\n");
+        host_side.SetNMEASentence(sentence);
+        sentences++;
+
+        // OpenCPN's own use of the same sentence
+        nmea.Assign(line, length);
+        if(nmea.PreParse()) {
+            if(nmea.LastSentenceReceived == SID_GGA && nmea.Parse())
+                satellites = nmea.Gga.NumberOfSatellitesInUse;
+            else if(nmea.LastSentenceReceived == SID_RMB && nmea.Parse() && nmea.Rmb.IsDataValid == NTrue) {
+                g_host.have_waypoint = true;
+                g_host.waypoint_lat = nmea.Rmb.DestinationPosition.Latitude.DegreesE7 / 1e7;
+                g_host.waypoint_lon = nmea.Rmb.DestinationPosition.Longitude.DegreesE7 / 1e7;
+            } else if(nmea.LastSentenceReceived == SID_RMC && nmea.Parse() && nmea.Rmc.IsDataValid == NTrue) {
+                PlugIn_Position_Fix_Ex fix;
+                fix.Lat = nmea.Rmc.Position.Latitude.DegreesE7 / 1e7;
+                fix.Lon = nmea.Rmc.Position.Longitude.DegreesE7 / 1e7;
+                fix.Cog = nmea.Rmc.TrackMadeGoodDegreesTrue;
+                fix.Sog = nmea.Rmc.SpeedOverGroundKnots;
+                fix.Var = nmea.Rmc.MagneticVariationDirection == West ?
+                    -nmea.Rmc.MagneticVariation : nmea.Rmc.MagneticVariation;
+                fix.Hdm = fix.Hdt = NAN;
+                fix.FixTime = (time_t)time;
+                fix.nSats = satellites;
+                host_side.SetPositionFixEx(fix);
+                fixes++;
+
+                // and the WMM plugin's answer
+                if(g_host.variation_requested && !std::isnan(fix.Var)) {
+                    wxJSONValue v;
+                    v[_T("Decl")] = fix.Var;
+                    wxJSONWriter w;
+                    wxString id(_T("WMM_VARIATION_BOAT")), body;
+                    w.Write(v, body);
+                    host_side.SetPluginMessage(id, body);
+                    g_host.variation_requested = false;
+                }
+            }
+        }
+        nmea_seconds += Seconds() - t0;
+    }
+    fclose(f);
+
+    plugin.RunUntil(ToDateTime(anchors.back().time), trace, start);
+    wall = Seconds() - wall;
+    plugin.DeInit();
+
+    if(trace != stdout)
+        fclose(trace);
+
+    double logged = anchors.back().time - anchors[0].time;
+    fprintf(stderr, "%s: %ld sentences, %ld position fixes, %.0f s logged\n",
+            log_path, sentences, fixes, logged);
+    fprintf(stderr, "replayed in %.3f s, %.0fx real time, %.0f sentences/s\n",
+            wall, logged / wall, sentences / wall);
+    fprintf(stderr, "sentences: %.0f ns each\n", nmea_seconds * 1e9 / (sentences ? sentences : 1));
+    fprintf(stderr, "updates: %lu, %.0f ns each, %lu rotations\n", plugin.m_updates,
+            plugin.m_update_seconds * 1e9 / (plugin.m_updates ? plugin.m_updates : 1),
+            plugin.m_rotations);
+
+    delete g_host.config;
+    return 0;
+}